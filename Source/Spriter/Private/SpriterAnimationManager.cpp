@@ -0,0 +1,239 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterAnimationManager.h"
+#include "SpriterSkeletonComponent.h"
+#include "ParallelFor.h"
+
+
+// Static's Initialization
+TMap<UWorld*, FSpriterAnimationManager*> FSpriterAnimationManager::Managers;
+FDelegateHandle FSpriterAnimationManager::OnWorldCleanupHandle;
+
+
+// FSpriterManagerTickFunction
+
+FSpriterManagerTickFunction::FSpriterManagerTickFunction()
+	: Manager(nullptr)
+{
+	bCanEverTick = true;
+	bStartWithTickEnabled = true;
+}
+
+void FSpriterManagerTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Manager && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Manager->TickGroup(TickGroup, DeltaTime);
+	}
+}
+
+FString FSpriterManagerTickFunction::DiagnosticMessage()
+{
+	return TEXT("FSpriterManagerTickFunction");
+}
+
+
+// FSpriterAnimationManager
+
+FSpriterAnimationManager& FSpriterAnimationManager::Get(UWorld* World)
+{
+	FSpriterAnimationManager*& Manager = Managers.FindOrAdd(World);
+	if (!Manager)
+	{
+		Manager = new FSpriterAnimationManager(World);
+	}
+
+	return *Manager;
+}
+
+FSpriterAnimationManager* FSpriterAnimationManager::Find(UWorld* World)
+{
+	FSpriterAnimationManager** Manager = Managers.Find(World);
+	return Manager ? *Manager : nullptr;
+}
+
+void FSpriterAnimationManager::Startup()
+{
+	OnWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&FSpriterAnimationManager::OnWorldCleanup);
+}
+
+void FSpriterAnimationManager::Shutdown()
+{
+	FWorldDelegates::OnWorldCleanup.Remove(OnWorldCleanupHandle);
+
+	for (TPair<UWorld*, FSpriterAnimationManager*>& Pair : Managers)
+	{
+		delete Pair.Value;
+	}
+	Managers.Empty();
+}
+
+void FSpriterAnimationManager::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	FSpriterAnimationManager* Manager = nullptr;
+	if (Managers.RemoveAndCopyValue(World, Manager))
+	{
+		delete Manager;
+	}
+}
+
+FSpriterAnimationManager::FGroup::FGroup()
+	: bNeedsSort(false)
+{
+}
+
+FSpriterAnimationManager::FSpriterAnimationManager(UWorld* InWorld)
+	: World(InWorld)
+{
+	FMemory::Memzero(Groups, sizeof(Groups));
+}
+
+FSpriterAnimationManager::~FSpriterAnimationManager()
+{
+	for (FGroup*& Group : Groups)
+	{
+		if (Group)
+		{
+			if (Group->TickFunction.IsTickFunctionRegistered())
+			{
+				Group->TickFunction.UnRegisterTickFunction();
+			}
+
+			delete Group;
+			Group = nullptr;
+		}
+	}
+}
+
+void FSpriterAnimationManager::Register(USpriterSkeletonComponent* Component)
+{
+	const int32 TickGroup = FMath::Clamp<int32>(Component->AnimationTickGroup, 0, TG_MAX - 1);
+
+	FGroup*& Group = Groups[TickGroup];
+	if (!Group)
+	{
+		Group = new FGroup();
+		Group->TickFunction.Manager = this;
+		Group->TickFunction.TickGroup = (ETickingGroup)TickGroup;
+		if (World && World->PersistentLevel)
+		{
+			Group->TickFunction.RegisterTickFunction(World->PersistentLevel);
+		}
+	}
+
+	if (!Group->Components.Contains(Component))
+	{
+		Group->Components.Add(Component);
+		Group->bNeedsSort = true;
+	}
+}
+
+void FSpriterAnimationManager::Unregister(USpriterSkeletonComponent* Component)
+{
+	for (FGroup* Group : Groups)
+	{
+		if (Group)
+		{
+			// Removing keeps the others in order, so no sort is needed
+			Group->Components.RemoveSingle(Component);
+
+			// Delegates fired while a group updates may take other Skeletons of the same Batch down with them
+			const int32 BatchIndex = Group->Batch.Find(Component);
+			if (BatchIndex != INDEX_NONE)
+			{
+				Group->Batch[BatchIndex] = nullptr;
+			}
+		}
+	}
+}
+
+void FSpriterAnimationManager::TickGroup(ETickingGroup TickGroup, float DeltaTime)
+{
+	FGroup* Group = Groups[TickGroup];
+	if (!Group || Group->Components.Num() == 0)
+	{
+		return;
+	}
+
+	// Priority first, then Skeletons sharing Import Data and Animation next to each other so their Keys stay in cache
+	if (Group->bNeedsSort)
+	{
+		Group->Components.StableSort([](const USpriterSkeletonComponent& A, const USpriterSkeletonComponent& B)
+		{
+			if (A.AnimationPriority != B.AnimationPriority)
+			{
+				return A.AnimationPriority > B.AnimationPriority;
+			}
+			if (A.Skeleton != B.Skeleton)
+			{
+				return A.Skeleton < B.Skeleton;
+			}
+			return A.ActiveAnimation < B.ActiveAnimation;
+		});
+		Group->bNeedsSort = false;
+	}
+
+	// Initializing may create Sprite Components, so it has to happen here on the game thread
+	TArray<USpriterSkeletonComponent*>& Batch = Group->Batch;
+	TArray<USpriterSkeletonComponent*>& ParallelBatch = Group->ParallelBatch;
+	Batch.Reset();
+	ParallelBatch.Reset();
+	for (USpriterSkeletonComponent* Component : Group->Components)
+	{
+		// Deactivated Skeletons stop updating, like their own Tick would
+		if (!Component->IsActive())
+		{
+			continue;
+		}
+
+		if (Component->IsInitialized(true) && Component->AnimationState != ESpriterAnimationState::NONE)
+		{
+			Component->UpdateLOD(GetComponentDeltaTime(Component, DeltaTime));
+			Batch.Add(Component);
+
+			if (Component->bParallelEvaluation)
+			{
+				ParallelBatch.Add(Component);
+			}
+		}
+	}
+
+	ParallelFor(ParallelBatch.Num(), [&ParallelBatch](int32 Index)
+	{
+		ParallelBatch[Index]->EvaluateSkeleton();
+	}, !FApp::ShouldUseThreadingForPerformance());
+
+	for (USpriterSkeletonComponent* Component : Batch)
+	{
+		if (!Component->bParallelEvaluation)
+		{
+			Component->EvaluateSkeleton();
+		}
+	}
+
+	for (USpriterSkeletonComponent* Component : Batch)
+	{
+		if (Component)
+		{
+			Component->ApplySkeleton();
+		}
+	}
+
+	for (USpriterSkeletonComponent* Component : Batch)
+	{
+		if (Component)
+		{
+			Component->AdvanceAnimation(GetComponentDeltaTime(Component, DeltaTime));
+		}
+	}
+
+	Batch.Reset();
+	ParallelBatch.Reset();
+}
+
+float FSpriterAnimationManager::GetComponentDeltaTime(const USpriterSkeletonComponent* Component, float DeltaTime)
+{
+	const AActor* ComponentOwner = Component->GetOwner();
+	return ComponentOwner ? (DeltaTime * ComponentOwner->CustomTimeDilation) : DeltaTime;
+}
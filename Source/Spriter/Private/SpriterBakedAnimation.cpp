@@ -0,0 +1,287 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterBakedAnimation.h"
+#include "SpriterCurve.h"
+
+
+// Helpers
+
+// Resolves every channel of one Timeline to a constant or a packed channel, then quantizes its packed channels row by row, skipping Samples without a Key
+static void CompressTimeline(const float* Values, const uint16* Keys, int32 NumSamples, FSpriterBakedTimeline& OutTimeline, TArray<uint16>& OutData)
+{
+	float Range[ESpriterBakedChannel::Count];
+
+	OutTimeline.NumPacked = 0;
+	OutTimeline.Offset = OutData.Num();
+
+	for (int32 Channel = 0; Channel < ESpriterBakedChannel::Count; ++Channel)
+	{
+		const float* ChannelValues = &Values[Channel * NumSamples];
+
+		float Min = MAX_flt;
+		float Max = -MAX_flt;
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			if (Keys[SampleIndex] != FSpriterBakedAnimation::NO_KEY)
+			{
+				Min = FMath::Min(Min, ChannelValues[SampleIndex]);
+				Max = FMath::Max(Max, ChannelValues[SampleIndex]);
+			}
+		}
+
+		if (Min > Max)
+		{
+			Min = Max = 0.f;
+		}
+
+		OutTimeline.Min[Channel] = Min;
+
+		// Constant channels only keep their value
+		if ((Max - Min) > KINDA_SMALL_NUMBER)
+		{
+			Range[OutTimeline.NumPacked] = Max - Min;
+			OutTimeline.PackedSteps[OutTimeline.NumPacked] = (Max - Min) / MAX_uint16;
+			OutTimeline.PackedChannels[OutTimeline.NumPacked] = (uint8)Channel;
+			++OutTimeline.NumPacked;
+		}
+	}
+
+	if (OutTimeline.NumPacked == 0)
+	{
+		return;
+	}
+
+	OutData.Reserve(OutData.Num() + (NumSamples * OutTimeline.NumPacked));
+	for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+	{
+		for (int32 PackedIndex = 0; PackedIndex < OutTimeline.NumPacked; ++PackedIndex)
+		{
+			const int32 Channel = OutTimeline.PackedChannels[PackedIndex];
+			const float Normalized = (Keys[SampleIndex] != FSpriterBakedAnimation::NO_KEY) ? ((Values[(Channel * NumSamples) + SampleIndex] - OutTimeline.Min[Channel]) / Range[PackedIndex]) : 0.f;
+			OutData.Add((uint16)FMath::Clamp(FMath::RoundToInt(Normalized * MAX_uint16), 0, (int32)MAX_uint16));
+		}
+	}
+}
+
+
+// FSpriterBakedTimeline
+
+FSpriterBakedTimeline::FSpriterBakedTimeline()
+	: NumPacked(0)
+	, Offset(0)
+{
+	FMemory::Memzero(Min);
+	FMemory::Memzero(PackedSteps);
+	FMemory::Memzero(PackedChannels);
+}
+
+FArchive& operator<<(FArchive& Ar, FSpriterBakedTimeline& Timeline)
+{
+	for (int32 Channel = 0; Channel < ESpriterBakedChannel::Count; ++Channel)
+	{
+		Ar << Timeline.Min[Channel];
+		Ar << Timeline.PackedSteps[Channel];
+		Ar << Timeline.PackedChannels[Channel];
+	}
+
+	Ar << Timeline.NumPacked;
+	Ar << Timeline.Offset;
+
+	return Ar;
+}
+
+
+// FSpriterBakedAnimation
+
+FSpriterBakedAnimation::FSpriterBakedAnimation()
+	: SampleRate(0.f)
+	, NumSamples(0)
+	, NumTimelines(0)
+	, LengthInMS(0)
+{
+}
+
+void FSpriterBakedAnimation::Bake(FSpriterAnimation& Animation, float InSampleRate)
+{
+	// Key indices are stored as uint16 with NO_KEY reserved, an Animation with more Keys plays from its Keys instead
+	bool bKeysFit = Animation.MainlineKeys.Num() < NO_KEY;
+	for (const FSpriterTimeline& Timeline : Animation.Timelines)
+	{
+		bKeysFit &= Timeline.Keys.Num() < NO_KEY;
+	}
+
+	if (!bKeysFit)
+	{
+		UE_LOG(LogSpriterImporter, Warning, TEXT("FSpriterBakedAnimation::Bake() : Animation '%s' has more Keys than a Baked Animation can index, it will play from its Keys"), *Animation.Name);
+		*this = FSpriterBakedAnimation();
+		return;
+	}
+
+	SampleRate = InSampleRate;
+	LengthInMS = Animation.LengthInMS;
+	NumTimelines = Animation.Timelines.Num();
+	NumSamples = (SampleRate > 0.f) ? (FMath::CeilToInt((LengthInMS * SampleRate) / 1000.f) + 1) : 0;
+
+	MainlineKeys.Init(NO_KEY, NumSamples);
+	TimelineKeys.Init(NO_KEY, NumSamples * NumTimelines);
+	Timelines.SetNum(NumTimelines);
+	QuantizedData.Empty();
+
+	// Uncompressed Samples of every channel, stored as [(TimelineIndex * ESpriterBakedChannel::Count + Channel) * NumSamples + SampleIndex]
+	TArray<float> Values;
+	Values.SetNumZeroed(NumTimelines * ESpriterBakedChannel::Count * NumSamples);
+
+	// Evaluate every Sample through the same Key search and Pose evaluator the Keyframe path uses
+	FSpriterPlaybackCursor Cursor;
+	Cursor.Reset(&Animation);
+
+	TArray<FSpriterTimelineKeyPair> KeyPairs;
+	KeyPairs.SetNum(NumTimelines);
+
+	FSpriterPose Pose;
+	Pose.SetNum(NumTimelines);
+
+	for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+	{
+		const float TimeMS = GetSampleTimeMS(SampleIndex);
+
+		const int32 MainlineKey = FSpriterPlaybackCursor::FindKey(Animation.MainlineKeys, TimeMS, Cursor.MainlineKey);
+		MainlineKeys[SampleIndex] = (MainlineKey != INDEX_NONE) ? (uint16)MainlineKey : NO_KEY;
+
+		// Timeline Keys are found and interpolated at the time the Mainline Key's Curve eased
+		const float EasedTimeMS = FSpriterCurve::EaseMainlineTime(Animation, MainlineKey, TimeMS);
+
+		for (int32 TimelineIndex = 0; TimelineIndex < NumTimelines; ++TimelineIndex)
+		{
+			FSpriterTimeline& Timeline = Animation.Timelines[TimelineIndex];
+			FSpriterTimelineKeyPair& Keys = KeyPairs[TimelineIndex];
+			Keys.Reset();
+
+			const int32 Key = FSpriterPlaybackCursor::FindKey(Timeline.Keys, EasedTimeMS, Cursor.TimelineKeys[TimelineIndex]);
+			if (Key != INDEX_NONE)
+			{
+				Keys.First = &Timeline.Keys[Key];
+				Keys.Second = &Timeline.Keys[(Key + 1) % Timeline.Keys.Num()];
+				Keys.Alpha = FSpriterPlaybackCursor::GetPlayingAlpha(EasedTimeMS, Keys.First->TimeInMS, Keys.Second->TimeInMS, LengthInMS);
+				Keys.Alpha = FSpriterCurve::EaseTimelineAlpha(*Keys.First, Keys.Alpha);
+				TimelineKeys[(TimelineIndex * NumSamples) + SampleIndex] = (uint16)Key;
+			}
+		}
+
+		FSpriterPoseEvaluator::Evaluate(KeyPairs, Pose);
+
+		for (int32 TimelineIndex = 0; TimelineIndex < NumTimelines; ++TimelineIndex)
+		{
+			if (!Pose.IsSampled(TimelineIndex))
+			{
+				continue;
+			}
+
+			float* Channels = &Values[TimelineIndex * ESpriterBakedChannel::Count * NumSamples];
+			const FLinearColor Color = Pose.GetColor(TimelineIndex);
+
+			Channels[(ESpriterBakedChannel::X * NumSamples) + SampleIndex] = Pose.X[TimelineIndex];
+			Channels[(ESpriterBakedChannel::Y * NumSamples) + SampleIndex] = Pose.Y[TimelineIndex];
+			Channels[(ESpriterBakedChannel::ScaleX * NumSamples) + SampleIndex] = Pose.ScaleX[TimelineIndex];
+			Channels[(ESpriterBakedChannel::ScaleY * NumSamples) + SampleIndex] = Pose.ScaleY[TimelineIndex];
+			Channels[(ESpriterBakedChannel::R * NumSamples) + SampleIndex] = Color.R;
+			Channels[(ESpriterBakedChannel::G * NumSamples) + SampleIndex] = Color.G;
+			Channels[(ESpriterBakedChannel::B * NumSamples) + SampleIndex] = Color.B;
+			Channels[(ESpriterBakedChannel::A * NumSamples) + SampleIndex] = Color.A;
+
+			// Keep the Angle within half a turn of the previous Sample, so lerping between Samples never spins the wrong way
+			float Angle = Pose.Angle[TimelineIndex];
+			if (SampleIndex > 0 && TimelineKeys[(TimelineIndex * NumSamples) + SampleIndex - 1] != NO_KEY)
+			{
+				const float PreviousAngle = Channels[(ESpriterBakedChannel::Angle * NumSamples) + SampleIndex - 1];
+				Angle = PreviousAngle + FMath::UnwindDegrees(Angle - PreviousAngle);
+			}
+			Channels[(ESpriterBakedChannel::Angle * NumSamples) + SampleIndex] = Angle;
+		}
+	}
+
+	// Compress every Timeline into its own rows
+	for (int32 TimelineIndex = 0; TimelineIndex < NumTimelines; ++TimelineIndex)
+	{
+		CompressTimeline(&Values[TimelineIndex * ESpriterBakedChannel::Count * NumSamples], &TimelineKeys[TimelineIndex * NumSamples], NumSamples, Timelines[TimelineIndex], QuantizedData);
+	}
+
+	QuantizedData.Shrink();
+}
+
+void FSpriterBakedAnimation::GetSample(float TimeMS, int32& OutSampleIndex, float& OutAlpha) const
+{
+	const float SamplePosition = FMath::Max(0.f, (TimeMS * SampleRate) / 1000.f);
+
+	OutSampleIndex = FMath::Clamp(FMath::FloorToInt(SamplePosition), 0, FMath::Max(0, NumSamples - 2));
+
+	const float FirstTimeMS = GetSampleTimeMS(OutSampleIndex);
+	const float SecondTimeMS = GetSampleTimeMS(OutSampleIndex + 1);
+	OutAlpha = (SecondTimeMS > FirstTimeMS) ? FMath::Clamp((TimeMS - FirstTimeMS) / (SecondTimeMS - FirstTimeMS), 0.f, 1.f) : 0.f;
+}
+
+int32 FSpriterBakedAnimation::GetMainlineKey(int32 SampleIndex) const
+{
+	if (MainlineKeys.IsValidIndex(SampleIndex) && MainlineKeys[SampleIndex] != NO_KEY)
+	{
+		return MainlineKeys[SampleIndex];
+	}
+
+	return INDEX_NONE;
+}
+
+bool FSpriterBakedAnimation::SampleTimeline(int32 TimelineIndex, int32 SampleIndex, float Alpha, FSpriterTransform2D& OutTransform, FLinearColor& OutColor, int32& OutKey) const
+{
+	if (TimelineIndex < 0 || TimelineIndex >= NumTimelines || SampleIndex < 0 || SampleIndex + 1 >= NumSamples)
+	{
+		return false;
+	}
+
+	const uint16 Key = TimelineKeys[(TimelineIndex * NumSamples) + SampleIndex];
+	if (Key == NO_KEY)
+	{
+		return false;
+	}
+
+	// The next Sample may not have a Key yet either, hold the current one then
+	if (TimelineKeys[(TimelineIndex * NumSamples) + SampleIndex + 1] == NO_KEY)
+	{
+		Alpha = 0.f;
+	}
+
+	float Values[ESpriterBakedChannel::Count];
+	Timelines[TimelineIndex].Decode(QuantizedData.GetData(), SampleIndex, Alpha, Values);
+
+	OutTransform.X = Values[ESpriterBakedChannel::X];
+	OutTransform.Y = Values[ESpriterBakedChannel::Y];
+	OutTransform.Angle = Values[ESpriterBakedChannel::Angle];
+	OutTransform.ScaleX = Values[ESpriterBakedChannel::ScaleX];
+	OutTransform.ScaleY = Values[ESpriterBakedChannel::ScaleY];
+	OutColor.R = Values[ESpriterBakedChannel::R];
+	OutColor.G = Values[ESpriterBakedChannel::G];
+	OutColor.B = Values[ESpriterBakedChannel::B];
+	OutColor.A = Values[ESpriterBakedChannel::A];
+	OutKey = Key;
+
+	return true;
+}
+
+FArchive& operator<<(FArchive& Ar, FSpriterBakedAnimation& Baked)
+{
+	Ar << Baked.SampleRate;
+	Ar << Baked.NumSamples;
+	Ar << Baked.NumTimelines;
+	Ar << Baked.LengthInMS;
+	Ar << Baked.MainlineKeys;
+	Ar << Baked.TimelineKeys;
+	Ar << Baked.Timelines;
+	Ar << Baked.QuantizedData;
+
+	return Ar;
+}
+
+SIZE_T FSpriterBakedAnimation::GetAllocatedSize() const
+{
+	return MainlineKeys.GetAllocatedSize() + TimelineKeys.GetAllocatedSize() + Timelines.GetAllocatedSize() + QuantizedData.GetAllocatedSize();
+}
@@ -0,0 +1,81 @@
+#include "SpriterPrivatePCH.h" // Change to match your plugin's PCH file name
+#include "SpriterBlendSpace.h"
+
+FSpriterBlendSample::FSpriterBlendSample()
+	: AnimationName("")
+	, Position(FVector2D::ZeroVector)
+{
+}
+
+FSpriterBlendSampleWeight::FSpriterBlendSampleWeight()
+	: SampleIndex(INDEX_NONE)
+	, Weight(0.f)
+{
+}
+
+FSpriterBlendSampleWeight::FSpriterBlendSampleWeight(int32 InSampleIndex, float InWeight)
+	: SampleIndex(InSampleIndex)
+	, Weight(InWeight)
+{
+}
+
+USpriterBlendSpace::USpriterBlendSpace()
+	: bIs2D(false)
+{
+}
+
+void USpriterBlendSpace::GetSampleWeights(const FVector2D& Input, TArray<FSpriterBlendSampleWeight>& OutWeights) const
+{
+	OutWeights.Reset();
+
+	const FVector2D Mask = bIs2D ? FVector2D(1.f, 1.f) : FVector2D(1.f, 0.f);
+	const FVector2D Point = Input * Mask;
+
+	// Gradient Band Interpolation, each Sample fades out over the band towards every other Sample.
+	// Exact at the Samples and linear between two neighbours, which makes it plain 1D interpolation when Y is ignored.
+	float TotalWeight = 0.f;
+	for (int32 SampleIndex = 0; SampleIndex < Samples.Num(); ++SampleIndex)
+	{
+		const FVector2D SamplePosition = Samples[SampleIndex].Position * Mask;
+
+		float Weight = 1.f;
+		for (int32 OtherIndex = 0; OtherIndex < Samples.Num() && Weight > 0.f; ++OtherIndex)
+		{
+			const FVector2D Band = (Samples[OtherIndex].Position * Mask) - SamplePosition;
+			const float BandSizeSquared = Band.SizeSquared();
+			if (OtherIndex == SampleIndex || BandSizeSquared <= SMALL_NUMBER)
+			{
+				continue;
+			}
+
+			Weight = FMath::Min(Weight, 1.f - (FVector2D::DotProduct(Point - SamplePosition, Band) / BandSizeSquared));
+		}
+
+		if (Weight > 0.f)
+		{
+			OutWeights.Add(FSpriterBlendSampleWeight(SampleIndex, Weight));
+			TotalWeight += Weight;
+		}
+	}
+
+	// Keep only the heaviest Samples, so a frame never evaluates more than a handful of Animations
+	OutWeights.Sort([](const FSpriterBlendSampleWeight& A, const FSpriterBlendSampleWeight& B) { return A.Weight > B.Weight; });
+	if (OutWeights.Num() > MAX_BLENDED_SAMPLES)
+	{
+		OutWeights.SetNum(MAX_BLENDED_SAMPLES);
+
+		TotalWeight = 0.f;
+		for (const FSpriterBlendSampleWeight& SampleWeight : OutWeights)
+		{
+			TotalWeight += SampleWeight.Weight;
+		}
+	}
+
+	if (TotalWeight > 0.f)
+	{
+		for (FSpriterBlendSampleWeight& SampleWeight : OutWeights)
+		{
+			SampleWeight.Weight /= TotalWeight;
+		}
+	}
+}
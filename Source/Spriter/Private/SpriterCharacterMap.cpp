@@ -5,4 +5,71 @@ FSpriterCharacterMapEntry::FSpriterCharacterMapEntry()
 	: AssociatedSprite(""),
 	ResultSprite(nullptr)
 {
-}
\ No newline at end of file
+}
+
+USpriterCharacterMap::USpriterCharacterMap()
+	: ChangeCount(0)
+{
+}
+
+#if WITH_EDITOR
+void USpriterCharacterMap::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	MarkEntrysChanged();
+}
+#endif
+
+void USpriterCharacterMap::MarkEntrysChanged()
+{
+	++ChangeCount;
+}
+
+UPaperSprite* USpriterCharacterMap::FindSprite(const FSpriterFile& File) const
+{
+	// Compared in place so no Strings get allocated
+	int32 SlashIndex = INDEX_NONE;
+	File.Name.FindLastChar(TEXT('/'), SlashIndex);
+
+	const int32 NameStart = SlashIndex + 1;
+	int32 NameEnd = File.Name.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromStart, NameStart);
+	if (NameEnd == INDEX_NONE)
+	{
+		NameEnd = File.Name.Len();
+	}
+
+	const int32 NameLength = NameEnd - NameStart;
+	if (NameLength <= 0)
+	{
+		return nullptr;
+	}
+
+	const TCHAR* AssociatedSprite = *File.Name + NameStart;
+	for (const FSpriterCharacterMapEntry& Entry : Entrys)
+	{
+		if (Entry.AssociatedSprite.Len() == NameLength && FCString::Strnicmp(*Entry.AssociatedSprite, AssociatedSprite, NameLength) == 0)
+		{
+			return Entry.ResultSprite;
+		}
+	}
+
+	return nullptr;
+}
+
+void USpriterCharacterMap::ResolveSprites(const FSpriterSCON& Data, int32 NumFiles, TArray<UPaperSprite*>& OutSprites) const
+{
+	OutSprites.Reset();
+	OutSprites.SetNumZeroed(NumFiles);
+
+	for (const FSpriterFolder& Folder : Data.Folders)
+	{
+		for (const FSpriterFile& File : Folder.Files)
+		{
+			if (OutSprites.IsValidIndex(File.TableIndex))
+			{
+				OutSprites[File.TableIndex] = FindSprite(File);
+			}
+		}
+	}
+}
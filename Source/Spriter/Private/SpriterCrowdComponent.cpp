@@ -0,0 +1,444 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterCrowdComponent.h"
+
+
+// Class's Initialization
+
+FSpriterCrowdInstance::FSpriterCrowdInstance()
+	: Location(FVector::ZeroVector)
+	, Angle(0.f)
+	, Scale(1.f, 1.f)
+	, AnimationIndex(0)
+	, TimeMS(0.f)
+	, PlayRate(1.f)
+	, BuiltSampleIndex(INDEX_NONE)
+	, BuiltAnimationIndex(INDEX_NONE)
+	, BuiltFirstDrawCall(INDEX_NONE)
+	, BuiltNumDrawCalls(0)
+{
+}
+
+USpriterCrowdComponent::USpriterCrowdComponent()
+	: Skeleton(nullptr)
+	, CharacterMap(nullptr)
+	, EntityIndex(0)
+	, FallbackBakeSampleRate(30.f)
+	, bSpritesDirty(true)
+	, ResolvedChangeCount(INDEX_NONE)
+	, bInstancesDirty(true)
+{
+	PrimaryComponentTick.bCanEverTick = true;
+}
+
+
+// Component Overrides
+
+void USpriterCrowdComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	for (FSpriterCrowdInstance& Instance : Instances)
+	{
+		AdvanceInstance(Instance, DeltaTime);
+	}
+
+	if (NeedsDrawCalls())
+	{
+		BuildDrawCalls();
+	}
+}
+
+#if WITH_EDITOR
+void USpriterCrowdComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	const FName PropertyName = PropertyChangedEvent.Property ? PropertyChangedEvent.Property->GetFName() : NAME_None;
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(USpriterCrowdComponent, Skeleton) || PropertyName == GET_MEMBER_NAME_CHECKED(USpriterCrowdComponent, EntityIndex) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(USpriterCrowdComponent, FallbackBakeSampleRate))
+	{
+		FallbackBakes.Empty();
+		bSpritesDirty = true;
+	}
+	else if (PropertyName == GET_MEMBER_NAME_CHECKED(USpriterCrowdComponent, CharacterMap))
+	{
+		bSpritesDirty = true;
+	}
+
+	bInstancesDirty = true;
+}
+#endif
+
+
+// Gameplay Methods
+
+void USpriterCrowdComponent::SetSkeleton(USpriterImportData* NewSkeleton, int32 NewEntityIndex)
+{
+	if (NewSkeleton != Skeleton || NewEntityIndex != EntityIndex)
+	{
+		Skeleton = NewSkeleton;
+		EntityIndex = NewEntityIndex;
+
+		FallbackBakes.Empty();
+		bSpritesDirty = true;
+		bInstancesDirty = true;
+	}
+}
+
+void USpriterCrowdComponent::SetCharacterMap(USpriterCharacterMap* Map)
+{
+	if (Map != CharacterMap)
+	{
+		CharacterMap = Map;
+
+		bSpritesDirty = true;
+		bInstancesDirty = true;
+	}
+}
+
+void USpriterCrowdComponent::MarkInstancesDirty()
+{
+	bInstancesDirty = true;
+}
+
+int32 USpriterCrowdComponent::AddInstance(const FVector& Location, int32 AnimationIndex, float TimeMS, float PlayRate)
+{
+	FSpriterCrowdInstance Instance = FSpriterCrowdInstance();
+	Instance.Location = Location;
+	Instance.AnimationIndex = AnimationIndex;
+	Instance.TimeMS = TimeMS;
+	Instance.PlayRate = PlayRate;
+
+	bInstancesDirty = true;
+	return Instances.Add(Instance);
+}
+
+void USpriterCrowdComponent::RemoveInstance(int32 InstanceIndex)
+{
+	if (Instances.IsValidIndex(InstanceIndex))
+	{
+		Instances.RemoveAt(InstanceIndex);
+		bInstancesDirty = true;
+	}
+}
+
+void USpriterCrowdComponent::ClearInstances()
+{
+	Instances.Empty();
+	bInstancesDirty = true;
+}
+
+void USpriterCrowdComponent::SetInstanceAnimation(int32 InstanceIndex, int32 AnimationIndex, float TimeMS)
+{
+	if (Instances.IsValidIndex(InstanceIndex))
+	{
+		Instances[InstanceIndex].AnimationIndex = AnimationIndex;
+		Instances[InstanceIndex].TimeMS = TimeMS;
+		Instances[InstanceIndex].BuiltSampleIndex = INDEX_NONE;
+	}
+}
+
+void USpriterCrowdComponent::SetInstanceLocation(int32 InstanceIndex, const FVector& Location)
+{
+	if (Instances.IsValidIndex(InstanceIndex))
+	{
+		// Only this Instance is built again
+		Instances[InstanceIndex].Location = Location;
+		Instances[InstanceIndex].BuiltSampleIndex = INDEX_NONE;
+	}
+}
+
+FSpriterEntity* USpriterCrowdComponent::GetEntity() const
+{
+	if (Skeleton && Skeleton->ImportedData.Entities.IsValidIndex(EntityIndex))
+	{
+		return &Skeleton->ImportedData.Entities[EntityIndex];
+	}
+
+	return nullptr;
+}
+
+
+// Crowd Methods
+
+void USpriterCrowdComponent::AdvanceInstance(FSpriterCrowdInstance& Instance, float DeltaTime) const
+{
+	FSpriterEntity* Entity = GetEntity();
+	if (!Entity || !Entity->Animations.IsValidIndex(Instance.AnimationIndex))
+	{
+		return;
+	}
+
+	const FSpriterAnimation& Animation = Entity->Animations[Instance.AnimationIndex];
+	if (Animation.LengthInMS <= 0)
+	{
+		return;
+	}
+
+	Instance.TimeMS += DeltaTime * 1000.f * Instance.PlayRate;
+	if (Animation.bIsLooping)
+	{
+		Instance.TimeMS = FMath::Fmod(Instance.TimeMS, (float)Animation.LengthInMS);
+		if (Instance.TimeMS < 0.f)
+		{
+			Instance.TimeMS += Animation.LengthInMS;
+		}
+	}
+	else
+	{
+		Instance.TimeMS = FMath::Clamp<float>(Instance.TimeMS, 0.f, Animation.LengthInMS);
+	}
+}
+
+bool USpriterCrowdComponent::NeedsDrawCalls()
+{
+	// Entrys of the Character Map changed, maybe through another Skeleton sharing it
+	if (CharacterMap && CharacterMap->GetChangeCount() != ResolvedChangeCount)
+	{
+		bSpritesDirty = true;
+	}
+
+	if (bInstancesDirty || bSpritesDirty)
+	{
+		return true;
+	}
+
+	FSpriterEntity* Entity = GetEntity();
+	for (const FSpriterCrowdInstance& Instance : Instances)
+	{
+		const FSpriterBakedAnimation* Baked = Entity ? GetBakedAnimation(Instance.AnimationIndex) : nullptr;
+
+		int32 SampleIndex = INDEX_NONE;
+		float SampleAlpha = 0.f;
+		if (Baked)
+		{
+			Baked->GetSample(Instance.TimeMS, SampleIndex, SampleAlpha);
+		}
+
+		if (SampleIndex != Instance.BuiltSampleIndex || Instance.AnimationIndex != Instance.BuiltAnimationIndex)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void USpriterCrowdComponent::BuildDrawCalls()
+{
+	FSpriterEntity* Entity = GetEntity();
+
+	// New Sprites or Instances change every Draw Call
+	const bool bRebuildAll = bInstancesDirty || bSpritesDirty;
+
+	int32 NumDrawCalls = 0;
+	for (FSpriterCrowdInstance& Instance : Instances)
+	{
+		const FSpriterBakedAnimation* Baked = Entity ? GetBakedAnimation(Instance.AnimationIndex) : nullptr;
+
+		int32 SampleIndex = INDEX_NONE;
+		float SampleAlpha = 0.f;
+		if (Baked)
+		{
+			Baked->GetSample(Instance.TimeMS, SampleIndex, SampleAlpha);
+		}
+
+		// An Instance still at the Sample it was built at keeps its Draw Calls, as long as the ones before it didn't move them
+		if (!bRebuildAll && SampleIndex == Instance.BuiltSampleIndex && Instance.AnimationIndex == Instance.BuiltAnimationIndex && Instance.BuiltFirstDrawCall == NumDrawCalls)
+		{
+			NumDrawCalls += Instance.BuiltNumDrawCalls;
+			continue;
+		}
+
+		Instance.BuiltSampleIndex = SampleIndex;
+		Instance.BuiltAnimationIndex = Instance.AnimationIndex;
+		Instance.BuiltFirstDrawCall = NumDrawCalls;
+		Instance.BuiltNumDrawCalls = Baked ? BuildInstance(Instance, *Baked, SampleIndex, SampleAlpha, NumDrawCalls) : 0;
+		NumDrawCalls += Instance.BuiltNumDrawCalls;
+	}
+
+	// Trimming without shrinking keeps every Draw Call's vertex storage around for the next frame
+	DrawCalls.SetNum(NumDrawCalls, false);
+	DrawCallMaterials.SetNum(NumDrawCalls, false);
+
+	bInstancesDirty = false;
+	MarkDrawCallsDirty();
+}
+
+int32 USpriterCrowdComponent::BuildInstance(FSpriterCrowdInstance& Instance, const FSpriterBakedAnimation& Baked, int32 SampleIndex, float SampleAlpha, int32 FirstDrawCall)
+{
+	FSpriterAnimation& Animation = GetEntity()->Animations[Instance.AnimationIndex];
+
+	const int32 MainlineKeyIndex = Baked.GetMainlineKey(SampleIndex);
+	if (!Animation.MainlineKeys.IsValidIndex(MainlineKeyIndex))
+	{
+		return 0;
+	}
+	const FSpriterMainlineKey& MainlineKey = Animation.MainlineKeys[MainlineKeyIndex];
+
+	// The Instance is the root every unparented Ref hangs from
+	const FSpriterTransform2D Root(0.f, 0.f, Instance.Angle, Instance.Scale.X, Instance.Scale.Y);
+	TimelineTransforms.SetNum(Animation.Timelines.Num(), false);
+	ComposeBones(MainlineKey, Baked, SampleIndex, SampleAlpha, Root);
+
+	FSpriterTransform2D Transform;
+	FLinearColor Color;
+	int32 Key = INDEX_NONE;
+
+	DrawOrder.Reset();
+	for (const FSpriterObjectRef& ObjectRef : MainlineKey.ObjectRefs)
+	{
+		if (Animation.Timelines.IsValidIndex(ObjectRef.TimelineIndex) && Animation.Timelines[ObjectRef.TimelineIndex].ObjectType == ESpriterObjectType::Sprite)
+		{
+			DrawOrder.Add(&ObjectRef);
+		}
+	}
+	DrawOrder.StableSort([](const FSpriterObjectRef& A, const FSpriterObjectRef& B) { return A.ZIndex < B.ZIndex; });
+
+	int32 NumDrawCalls = FirstDrawCall;
+	for (const FSpriterObjectRef* ObjectRef : DrawOrder)
+	{
+		if (!Baked.SampleTimeline(ObjectRef->TimelineIndex, SampleIndex, SampleAlpha, Transform, Color, Key))
+		{
+			continue;
+		}
+
+		const FSpriterFatTimelineKey& TimelineKey = Animation.Timelines[ObjectRef->TimelineIndex].Keys[Key];
+		UPaperSprite* PaperSprite = TimelineKey.File ? GetSprite(*TimelineKey.File) : nullptr;
+		if (!PaperSprite)
+		{
+			continue;
+		}
+
+		// Only Timelines this Mainline Key composed hold this Instance's Transforms
+		const bool bHasParent = TimelineTransforms.IsValidIndex(ObjectRef->ParentTimelineIndex) && ComposedTimelines[ObjectRef->ParentTimelineIndex];
+		const FSpriterTransform2D& Parent = bHasParent ? TimelineTransforms[ObjectRef->ParentTimelineIndex] : Root;
+
+		if (NumDrawCalls == DrawCalls.Num())
+		{
+			DrawCalls.AddDefaulted();
+			DrawCallMaterials.AddDefaulted();
+		}
+
+		DrawCallMaterials[NumDrawCalls] = PaperSprite->GetDefaultMaterial();
+		FSpriteDrawCallRecord& DrawCall = DrawCalls[NumDrawCalls++];
+		BuildDrawCall(DrawCall, PaperSprite, TimelineKey, Parent.Compose(Transform), Color);
+		DrawCall.Destination = Instance.Location;
+	}
+
+	return NumDrawCalls - FirstDrawCall;
+}
+
+void USpriterCrowdComponent::ComposeBones(const FSpriterMainlineKey& MainlineKey, const FSpriterBakedAnimation& Baked, int32 SampleIndex, float SampleAlpha, const FSpriterTransform2D& Root)
+{
+	ComposedTimelines.Init(false, TimelineTransforms.Num());
+
+	FSpriterTransform2D Transform;
+	FLinearColor Color;
+	int32 Key = INDEX_NONE;
+
+	// Spriter lists Bone Refs Parent before Child, so this normally takes one pass.
+	// Refs listed before their Parent wait for a later pass, instead of composing onto a Transform from another Instance
+	int32 NumPending = MainlineKey.BoneRefs.Num();
+	bool bComposedAny = true;
+	while (NumPending > 0 && bComposedAny)
+	{
+		bComposedAny = false;
+		for (const FSpriterRef& BoneRef : MainlineKey.BoneRefs)
+		{
+			if (!TimelineTransforms.IsValidIndex(BoneRef.TimelineIndex) || ComposedTimelines[BoneRef.TimelineIndex])
+			{
+				continue;
+			}
+
+			const bool bHasParent = TimelineTransforms.IsValidIndex(BoneRef.ParentTimelineIndex);
+			if (bHasParent && !ComposedTimelines[BoneRef.ParentTimelineIndex])
+			{
+				continue;
+			}
+
+			const FSpriterTransform2D& Parent = bHasParent ? TimelineTransforms[BoneRef.ParentTimelineIndex] : Root;
+			TimelineTransforms[BoneRef.TimelineIndex] = Baked.SampleTimeline(BoneRef.TimelineIndex, SampleIndex, SampleAlpha, Transform, Color, Key) ? Parent.Compose(Transform) : Parent;
+			ComposedTimelines[BoneRef.TimelineIndex] = true;
+
+			bComposedAny = true;
+			--NumPending;
+		}
+	}
+
+	// Whatever is left has an invalid Ref or a Parent that is never composed, it hangs from the Instance instead
+	for (const FSpriterRef& BoneRef : MainlineKey.BoneRefs)
+	{
+		if (TimelineTransforms.IsValidIndex(BoneRef.TimelineIndex) && !ComposedTimelines[BoneRef.TimelineIndex])
+		{
+			TimelineTransforms[BoneRef.TimelineIndex] = Baked.SampleTimeline(BoneRef.TimelineIndex, SampleIndex, SampleAlpha, Transform, Color, Key) ? Root.Compose(Transform) : Root;
+			ComposedTimelines[BoneRef.TimelineIndex] = true;
+		}
+	}
+}
+
+const FSpriterBakedAnimation* USpriterCrowdComponent::GetBakedAnimation(int32 AnimationIndex)
+{
+	FSpriterEntity* Entity = GetEntity();
+	if (!Entity || !Entity->Animations.IsValidIndex(AnimationIndex))
+	{
+		return nullptr;
+	}
+
+	FSpriterAnimation& Animation = Entity->Animations[AnimationIndex];
+
+	const FSpriterBakedAnimation* Baked = Skeleton->GetBakedAnimation(&Animation);
+	if (Baked && Baked->IsValid())
+	{
+		return Baked;
+	}
+
+	if (FallbackBakes.Num() != Entity->Animations.Num())
+	{
+		FallbackBakes.Empty(Entity->Animations.Num());
+		FallbackBakes.SetNum(Entity->Animations.Num());
+	}
+
+	FSpriterBakedAnimation& FallbackBake = FallbackBakes[AnimationIndex];
+	if (FallbackBake.NumSamples == 0)
+	{
+		if (!Skeleton->HasDerivedData())
+		{
+			Skeleton->BuildDerivedData();
+		}
+
+		FallbackBake.Bake(Animation, FallbackBakeSampleRate);
+	}
+
+	return FallbackBake.IsValid() ? &FallbackBake : nullptr;
+}
+
+UPaperSprite* USpriterCrowdComponent::GetSprite(const FSpriterFile& File)
+{
+	if (bSpritesDirty || (CharacterMap && CharacterMap->GetChangeCount() != ResolvedChangeCount))
+	{
+		ResolvedSprites.Reset();
+		ResolvedChangeCount = CharacterMap ? CharacterMap->GetChangeCount() : INDEX_NONE;
+		if (Skeleton && CharacterMap)
+		{
+			if (!Skeleton->HasDerivedData())
+			{
+				Skeleton->BuildDerivedData();
+			}
+
+			CharacterMap->ResolveSprites(Skeleton->ImportedData, Skeleton->GetNumFiles(), ResolvedSprites);
+		}
+
+		bSpritesDirty = false;
+	}
+
+	// Files made outside the Skeleton (like in Blueprints) have no Table Index, they're looked up by Name
+	if (File.TableIndex == INDEX_NONE)
+	{
+		return CharacterMap ? CharacterMap->FindSprite(File) : nullptr;
+	}
+
+	return ResolvedSprites.IsValidIndex(File.TableIndex) ? ResolvedSprites[File.TableIndex] : nullptr;
+}
@@ -0,0 +1,153 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterCurve.h"
+
+
+// Helpers
+
+static FORCEINLINE float CubeRoot(float Value)
+{
+	return (Value < 0.f) ? -FMath::Pow(-Value, 1.f / 3.f) : FMath::Pow(Value, 1.f / 3.f);
+}
+
+// Returns the root of A*T^3 + B*T^2 + C*T + D that lies in 0..1, using Cardano's method instead of an iterative solve
+static float SolveCubicInUnitRange(float A, float B, float C, float D)
+{
+	const float Tolerance = 1.e-4f;
+	float Roots[3];
+	int32 NumRoots = 0;
+
+	if (FMath::Abs(A) < SMALL_NUMBER)
+	{
+		// Quadratic, or linear when B is zero too
+		if (FMath::Abs(B) < SMALL_NUMBER)
+		{
+			if (FMath::Abs(C) > SMALL_NUMBER)
+			{
+				Roots[NumRoots++] = -D / C;
+			}
+		}
+		else
+		{
+			const float Discriminant = (C * C) - (4.f * B * D);
+			if (Discriminant >= 0.f)
+			{
+				const float SqrtDiscriminant = FMath::Sqrt(Discriminant);
+				Roots[NumRoots++] = (-C + SqrtDiscriminant) / (2.f * B);
+				Roots[NumRoots++] = (-C - SqrtDiscriminant) / (2.f * B);
+			}
+		}
+	}
+	else
+	{
+		// Depressed cubic U^3 + P*U + Q = 0, with T = U - B / 3A
+		const float NormB = B / A;
+		const float NormC = C / A;
+		const float NormD = D / A;
+		const float Offset = NormB / 3.f;
+		const float P = NormC - ((NormB * NormB) / 3.f);
+		const float Q = ((2.f * NormB * NormB * NormB) / 27.f) - ((NormB * NormC) / 3.f) + NormD;
+		const float Discriminant = ((Q * Q) / 4.f) + ((P * P * P) / 27.f);
+
+		if (Discriminant > SMALL_NUMBER)
+		{
+			const float SqrtDiscriminant = FMath::Sqrt(Discriminant);
+			Roots[NumRoots++] = CubeRoot((-Q / 2.f) + SqrtDiscriminant) + CubeRoot((-Q / 2.f) - SqrtDiscriminant) - Offset;
+		}
+		else if (Discriminant >= -SMALL_NUMBER)
+		{
+			const float U = CubeRoot(-Q / 2.f);
+			Roots[NumRoots++] = (2.f * U) - Offset;
+			Roots[NumRoots++] = -U - Offset;
+		}
+		else
+		{
+			const float Radius = 2.f * FMath::Sqrt(-P / 3.f);
+			const float Phi = FMath::Acos(FMath::Clamp((3.f * Q) / (P * Radius), -1.f, 1.f)) / 3.f;
+			for (int32 RootIndex = 0; RootIndex < 3; ++RootIndex)
+			{
+				Roots[NumRoots++] = (Radius * FMath::Cos(Phi - ((2.f * PI * RootIndex) / 3.f))) - Offset;
+			}
+		}
+	}
+
+	for (int32 RootIndex = 0; RootIndex < NumRoots; ++RootIndex)
+	{
+		if (Roots[RootIndex] >= -Tolerance && Roots[RootIndex] <= 1.f + Tolerance)
+		{
+			return FMath::Clamp(Roots[RootIndex], 0.f, 1.f);
+		}
+	}
+
+	return 0.f;
+}
+
+
+// FSpriterCurve
+
+float FSpriterCurve::Ease(ESpriterCurveType CurveType, float C1, float C2, float C3, float C4, float Alpha)
+{
+	const float T = Alpha;
+	const float InvT = 1.f - Alpha;
+
+	// Bernstein forms of Spriter's nested lerps, with the first control value at 0 and the last at 1
+	switch (CurveType)
+	{
+	case ESpriterCurveType::Instant:
+		return 0.f;
+	case ESpriterCurveType::Quadratic:
+		return (2.f * InvT * T * C1) + (T * T);
+	case ESpriterCurveType::Cubic:
+		return (3.f * InvT * InvT * T * C1) + (3.f * InvT * T * T * C2) + (T * T * T);
+	case ESpriterCurveType::Quartic:
+		return (4.f * InvT * InvT * InvT * T * C1) + (6.f * InvT * InvT * T * T * C2) + (4.f * InvT * T * T * T * C3) + (T * T * T * T);
+	case ESpriterCurveType::Quintic:
+		return (5.f * InvT * InvT * InvT * InvT * T * C1) + (10.f * InvT * InvT * InvT * T * T * C2) + (10.f * InvT * InvT * T * T * T * C3) + (5.f * InvT * T * T * T * T * C4) + (T * T * T * T * T);
+	case ESpriterCurveType::Bezier:
+		return SolveBezier(C1, C2, C3, C4, Alpha);
+	default:
+		return Alpha;
+	}
+}
+
+float FSpriterCurve::EaseMainlineTime(const FSpriterAnimation& Animation, int32 MainlineKey, float TimeMS)
+{
+	if (!Animation.MainlineKeys.IsValidIndex(MainlineKey))
+	{
+		return TimeMS;
+	}
+
+	const FSpriterMainlineKey& Key = Animation.MainlineKeys[MainlineKey];
+	if (Key.CurveType == ESpriterCurveType::Linear || Key.CurveType == ESpriterCurveType::INVALID)
+	{
+		return TimeMS;
+	}
+
+	const int32 NextTimeMS = Animation.MainlineKeys.IsValidIndex(MainlineKey + 1) ? Animation.MainlineKeys[MainlineKey + 1].TimeInMS : Animation.LengthInMS;
+	const float SpanMS = NextTimeMS - Key.TimeInMS;
+	if (SpanMS <= 0.f)
+	{
+		return TimeMS;
+	}
+
+	const float Alpha = FMath::Clamp((TimeMS - Key.TimeInMS) / SpanMS, 0.f, 1.f);
+	return Key.TimeInMS + (Ease(Key.CurveType, Key.C1, Key.C2, Key.C3, Key.C4, Alpha) * SpanMS);
+}
+
+float FSpriterCurve::EaseTimelineAlpha(const FSpriterTimelineKey& Key, float Alpha)
+{
+	return Ease(Key.CurveType, Key.C1, Key.C2, Key.C3, Key.C4, Alpha);
+}
+
+float FSpriterCurve::SolveBezier(float C1, float C2, float C3, float C4, float X)
+{
+	// X(T) = 3(1-T)^2 T C1 + 3(1-T) T^2 C3 + T^3, solve X(T) = X for T then evaluate Y(T)
+	const float A = 1.f + (3.f * C1) - (3.f * C3);
+	const float B = (3.f * C3) - (6.f * C1);
+	const float C = 3.f * C1;
+	const float T = SolveCubicInUnitRange(A, B, C, -X);
+	const float InvT = 1.f - T;
+
+	return (3.f * InvT * InvT * T * C2) + (3.f * InvT * T * T * C4) + (T * T * T);
+}
@@ -0,0 +1,10 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterCustomVersion.h"
+#include "CustomVersion.h"
+
+const FGuid FSpriterCustomVersion::GUID(0x5E1B7A43, 0x2C9D4F08, 0xA6E31B75, 0x94D0C2F1);
+
+// Register the custom version with core
+FCustomVersionRegistration GRegisterSpriterCustomVersion(FSpriterCustomVersion::GUID, FSpriterCustomVersion::LatestVersion, TEXT("SpriterVer"));
@@ -130,12 +130,18 @@ private:
 		KnownMainlineKeyKeys.Add(TEXT("bone_ref"));
 		KnownMainlineKeyKeys.Add(TEXT("object_ref"));
 		KnownMainlineKeyKeys.Add(TEXT("curve_type"));
+		KnownMainlineKeyKeys.Add(TEXT("c1"));
+		KnownMainlineKeyKeys.Add(TEXT("c2"));
+		KnownMainlineKeyKeys.Add(TEXT("c3"));
+		KnownMainlineKeyKeys.Add(TEXT("c4"));
 		KnownMainlineKeyKeys.Add(TEXT("id")); // Known but being ignored
 
 		KnownBasicTimelineKeyKeys.Add(TEXT("time"));
 		KnownBasicTimelineKeyKeys.Add(TEXT("curve_type"));
 		KnownBasicTimelineKeyKeys.Add(TEXT("c1"));
 		KnownBasicTimelineKeyKeys.Add(TEXT("c2"));
+		KnownBasicTimelineKeyKeys.Add(TEXT("c3"));
+		KnownBasicTimelineKeyKeys.Add(TEXT("c4"));
 		KnownBasicTimelineKeyKeys.Add(TEXT("spin"));
 		KnownBasicTimelineKeyKeys.Add(TEXT("id")); // Known but being ignored
 		KnownBasicTimelineKeyKeys.Add(TEXT("object"));
@@ -283,6 +289,18 @@ ESpriterCurveType FSpriterEnumHelper::StringToCurveType(const FString& InString)
 	{
 		return ESpriterCurveType::Cubic;
 	}
+	else if (InString == TEXT("quartic"))
+	{
+		return ESpriterCurveType::Quartic;
+	}
+	else if (InString == TEXT("quintic"))
+	{
+		return ESpriterCurveType::Quintic;
+	}
+	else if (InString == TEXT("bezier"))
+	{
+		return ESpriterCurveType::Bezier;
+	}
 	else
 	{
 		return ESpriterCurveType::INVALID;
@@ -419,6 +437,7 @@ FSpriterFile::FSpriterFile()
 	, Width(0)
 	, Height(0)
 	, FileType(ESpriterFileType::INVALID)
+	, TableIndex(INDEX_NONE)
 {
 }
 
@@ -883,6 +902,10 @@ bool FSpriterObjectRef::ParseFromJSON(FSpriterEntity* Owner, FSpriterAnimation*
 FSpriterMainlineKey::FSpriterMainlineKey()
 	: TimeInMS(INDEX_NONE)
 	, CurveType(ESpriterCurveType::INVALID)
+	, C1(0.f)
+	, C2(0.f)
+	, C3(0.f)
+	, C4(0.f)
 {
 }
 
@@ -932,6 +955,25 @@ bool FSpriterMainlineKey::ParseFromJSON(FSpriterEntity* Owner, FSpriterAnimation
 		CurveType = ESpriterCurveType::Linear;
 	}
 
+	// Optionally parse c1 through c4
+	double CDouble;
+	if (Tree->TryGetNumberField(TEXT("c1"), CDouble))
+	{
+		C1 = CDouble;
+	}
+	if (Tree->TryGetNumberField(TEXT("c2"), CDouble))
+	{
+		C2 = CDouble;
+	}
+	if (Tree->TryGetNumberField(TEXT("c3"), CDouble))
+	{
+		C3 = CDouble;
+	}
+	if (Tree->TryGetNumberField(TEXT("c4"), CDouble))
+	{
+		C4 = CDouble;
+	}
+
 	// Parse the object_ref array
 	const TArray<TSharedPtr<FJsonValue>>* ObjectRefDescriptors;
 	if (Tree->TryGetArrayField(TEXT("object_ref"), /*out*/ ObjectRefDescriptors))
@@ -963,6 +1005,8 @@ FSpriterTimelineKey::FSpriterTimelineKey()
 	, CurveType(ESpriterCurveType::INVALID)
 	, C1(0.f)
 	, C2(0.f)
+	, C3(0.f)
+	, C4(0.f)
 	, Spin(1)
 {
 }
@@ -1017,6 +1061,17 @@ bool FSpriterTimelineKey::ParseBasicsFromJSON(FSpriterEntity* Owner, TSharedPtr<
 		bSuccessfullyParsed = false;
 	}
 
+	// c3 and c4 are only written for quartic, quintic and bezier curves
+	double C3Double, C4Double;
+	if (Tree->TryGetNumberField(TEXT("c3"), C3Double))
+	{
+		C3 = C3Double;
+	}
+	if (Tree->TryGetNumberField(TEXT("c4"), C4Double))
+	{
+		C4 = C4Double;
+	}
+
 	// Optionally parse the spin
 	Tree->TryGetNumberField(TEXT("spin"), /*out*/ Spin);
 	if ((Spin != 1) && (Spin != -1) & (Spin != 0))
@@ -1039,6 +1094,9 @@ FSpriterFatTimelineKey::FSpriterFatTimelineKey()
 	, bUseDefaultPivot(true)
 	, PivotX(0.f)
 	, PivotY(0.f)
+	, RotatedPivot(FVector2D::ZeroVector)
+	, File(nullptr)
+	, PivotOffset(FVector2D::ZeroVector)
 {
 }
 
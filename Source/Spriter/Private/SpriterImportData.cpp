@@ -2,12 +2,18 @@
 
 #include "SpriterPrivatePCH.h"
 #include "SpriterImportData.h"
+#include "SpriterCustomVersion.h"
 
 //////////////////////////////////////////////////////////////////////////
 // USpriterImportData
 
 USpriterImportData::USpriterImportData(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, BakeSampleRate(0.f)
+	, RootTrackSampleRate(60.f)
+	, bBakeLoaded(false)
+	, bDerivedDataBuilt(false)
+	, NumFiles(0)
 {
 
 }
@@ -21,3 +27,220 @@ void USpriterImportData::GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags
 
 	Super::GetAssetRegistryTags(OutTags);
 }
+
+void USpriterImportData::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	Ar.UsingCustomVersion(FSpriterCustomVersion::GUID);
+
+	if (Ar.CustomVer(FSpriterCustomVersion::GUID) >= FSpriterCustomVersion::SerializeBakedAnimations)
+	{
+		// Cooked games load the Bake instead of Baking every Animation on load
+		if (Ar.IsSaving() && Ar.IsCooking() && !bDerivedDataBuilt)
+		{
+			BuildDerivedData();
+		}
+
+		bool bHasBake = Ar.IsSaving() && Ar.IsCooking() && BakedAnimations.Num() > 0;
+		Ar << bHasBake;
+
+		if (bHasBake)
+		{
+			Ar << BakedAnimations;
+			bBakeLoaded = Ar.IsLoading();
+		}
+	}
+}
+
+void USpriterImportData::PostLoad()
+{
+	Super::PostLoad();
+
+	BuildDerivedData();
+}
+
+SIZE_T USpriterImportData::GetResourceSize(EResourceSizeMode::Type Mode)
+{
+	SIZE_T ResourceSize = Super::GetResourceSize(Mode);
+
+	for (const FSpriterBakedAnimation& Baked : BakedAnimations)
+	{
+		ResourceSize += Baked.GetAllocatedSize();
+	}
+
+	for (const FSpriterRootTrack& RootTrack : RootTracks)
+	{
+		ResourceSize += RootTrack.Samples.GetAllocatedSize();
+	}
+
+	for (const FSpriterSkeletonBinding& EntityBinding : EntityBindings)
+	{
+		ResourceSize += EntityBinding.GetAllocatedSize();
+	}
+
+	return ResourceSize;
+}
+
+#if WITH_EDITOR
+void USpriterImportData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	BuildDerivedData();
+}
+#endif
+
+void USpriterImportData::BuildDerivedData()
+{
+	const float UnitsPerPixel = (PixelsPerUnrealUnit > 0.f) ? (1.f / PixelsPerUnrealUnit) : 1.f;
+
+	NumFiles = 0;
+	for (FSpriterFolder& Folder : ImportedData.Folders)
+	{
+		for (FSpriterFile& File : Folder.Files)
+		{
+			File.TableIndex = NumFiles++;
+		}
+	}
+
+	for (FSpriterEntity& Entity : ImportedData.Entities)
+	{
+		for (FSpriterAnimation& Animation : Entity.Animations)
+		{
+			for (FSpriterTimeline& Timeline : Animation.Timelines)
+			{
+				for (FSpriterFatTimelineKey& Key : Timeline.Keys)
+				{
+					const FSpriterSpatialInfo& Info = Key.Info;
+					Key.Transform = FSpriterTransform2D(Info.X * UnitsPerPixel, Info.Y * UnitsPerPixel, Info.AngleInDegrees, Info.ScaleX, Info.ScaleY);
+
+					float Sin = 0.f;
+					float Cos = 1.f;
+					FMath::SinCos(&Sin, &Cos, FMath::DegreesToRadians(Info.AngleInDegrees));
+					Key.RotatedPivot = FVector2D((Cos * Key.PivotX) - (Sin * Key.PivotY), (Sin * Key.PivotX) + (Cos * Key.PivotY)) * UnitsPerPixel;
+
+					Key.File = nullptr;
+					if (ImportedData.Folders.IsValidIndex(Key.FolderIndex) && ImportedData.Folders[Key.FolderIndex].Files.IsValidIndex(Key.FileIndex))
+					{
+						Key.File = &ImportedData.Folders[Key.FolderIndex].Files[Key.FileIndex];
+					}
+
+					// The importer creates every Sprite pivoted on its File's default Pivot, Keys with their own Pivot are offset from it
+					Key.PivotOffset = FVector2D::ZeroVector;
+					if (Key.File && !Key.bUseDefaultPivot)
+					{
+						const FSpriterFile& File = *Key.File;
+						Key.PivotOffset = FVector2D((File.PivotX - Key.PivotX) * File.Width, (File.PivotY - Key.PivotY) * File.Height) * UnitsPerPixel;
+					}
+				}
+			}
+		}
+	}
+
+	// Bake after the Keys have their derived data, Baking evaluates them. A loaded Bake is only kept the first time
+	if (bBakeLoaded)
+	{
+		bBakeLoaded = false;
+	}
+	else
+	{
+		BakedAnimations.Empty();
+		if (BakeSampleRate > 0.f)
+		{
+			for (FSpriterEntity& Entity : ImportedData.Entities)
+			{
+				for (FSpriterAnimation& Animation : Entity.Animations)
+				{
+					BakedAnimations.AddDefaulted();
+					BakedAnimations.Last().Bake(Animation, BakeSampleRate);
+				}
+			}
+		}
+	}
+
+	RootTracks.Empty();
+	if (!RootBoneName.IsEmpty())
+	{
+		for (FSpriterEntity& Entity : ImportedData.Entities)
+		{
+			for (FSpriterAnimation& Animation : Entity.Animations)
+			{
+				RootTracks.AddDefaulted();
+				RootTracks.Last().Build(Animation, RootBoneName, RootTrackSampleRate);
+			}
+		}
+	}
+
+	// Every Skeleton playing an Entity shares its Binding, instead of building the same tables per Component
+	EntityBindings.SetNum(ImportedData.Entities.Num());
+	for (int32 EntityIndex = 0; EntityIndex < ImportedData.Entities.Num(); ++EntityIndex)
+	{
+		EntityBindings[EntityIndex].Build(ImportedData.Entities[EntityIndex]);
+	}
+
+	bDerivedDataBuilt = true;
+}
+
+const FSpriterBakedAnimation* USpriterImportData::GetBakedAnimation(const FSpriterAnimation* Animation) const
+{
+	if (BakedAnimations.Num() > 0)
+	{
+		const int32 BakedIndex = GetAnimationIndex(Animation);
+		if (BakedAnimations.IsValidIndex(BakedIndex) && BakedAnimations[BakedIndex].IsValid())
+		{
+			return &BakedAnimations[BakedIndex];
+		}
+	}
+
+	return nullptr;
+}
+
+const FSpriterRootTrack* USpriterImportData::GetRootTrack(const FSpriterAnimation* Animation) const
+{
+	if (RootTracks.Num() > 0)
+	{
+		const int32 TrackIndex = GetAnimationIndex(Animation);
+		if (RootTracks.IsValidIndex(TrackIndex) && RootTracks[TrackIndex].IsValid())
+		{
+			return &RootTracks[TrackIndex];
+		}
+	}
+
+	return nullptr;
+}
+
+const FSpriterSkeletonBinding* USpriterImportData::GetEntityBinding(const FSpriterEntity* Entity) const
+{
+	const FSpriterEntity* FirstEntity = ImportedData.Entities.GetData();
+	if (Entity && ImportedData.Entities.Num() > 0 && Entity >= FirstEntity && Entity < FirstEntity + ImportedData.Entities.Num())
+	{
+		const int32 EntityIndex = Entity - FirstEntity;
+		if (EntityBindings.IsValidIndex(EntityIndex))
+		{
+			return &EntityBindings[EntityIndex];
+		}
+	}
+
+	return nullptr;
+}
+
+int32 USpriterImportData::GetAnimationIndex(const FSpriterAnimation* Animation) const
+{
+	if (Animation)
+	{
+		int32 FirstIndex = 0;
+		for (const FSpriterEntity& Entity : ImportedData.Entities)
+		{
+			const FSpriterAnimation* FirstAnimation = Entity.Animations.GetData();
+			if (Entity.Animations.Num() > 0 && Animation >= FirstAnimation && Animation < FirstAnimation + Entity.Animations.Num())
+			{
+				return FirstIndex + (Animation - FirstAnimation);
+			}
+
+			FirstIndex += Entity.Animations.Num();
+		}
+	}
+
+	return INDEX_NONE;
+}
@@ -1,5 +1,6 @@
 
 #include "SpriterPrivatePCH.h"
+#include "SpriterAnimationManager.h"
 
 DEFINE_LOG_CATEGORY(LogSpriterImporter);
 
@@ -8,10 +9,12 @@ class FSpriterModule : public FDefaultModuleImpl
 public:
 	virtual void StartupModule() override
 	{
+		FSpriterAnimationManager::Startup();
 	}
 
 	virtual void ShutdownModule() override
 	{
+		FSpriterAnimationManager::Shutdown();
 	}
 };
 
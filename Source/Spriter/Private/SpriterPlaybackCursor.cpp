@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterPlaybackCursor.h"
+
+
+FSpriterPlaybackCursor::FSpriterPlaybackCursor()
+	: Animation(nullptr)
+	, MainlineKey(INDEX_NONE)
+{
+}
+
+void FSpriterPlaybackCursor::Reset(const FSpriterAnimation* NewAnimation)
+{
+	Animation = NewAnimation;
+	MainlineKey = INDEX_NONE;
+
+	// SetNum keeps the allocation around, so switching between Animations of the same Entity rarely reallocates
+	TimelineKeys.SetNum(Animation ? Animation->Timelines.Num() : 0, false);
+	EventLineKeys.SetNum(Animation ? Animation->EventLines.Num() : 0, false);
+
+	for (int32& Key : TimelineKeys)
+	{
+		Key = INDEX_NONE;
+	}
+	for (int32& Key : EventLineKeys)
+	{
+		Key = INDEX_NONE;
+	}
+}
+
+float FSpriterPlaybackCursor::GetPlayingAlpha(float TimeMS, int32 FirstTimeMS, int32 SecondTimeMS, int32 LengthInMS)
+{
+	if (FirstTimeMS == SecondTimeMS)
+	{
+		return 0.f;
+	}
+
+	const float C1 = (TimeMS - FirstTimeMS);
+	const float C2 = (SecondTimeMS == 0) ? (LengthInMS - FirstTimeMS) : (SecondTimeMS - FirstTimeMS);
+	if (C2 == 0)
+	{
+		return 0.f;
+	}
+
+	return C1 / C2;
+}
@@ -0,0 +1,119 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterPose.h"
+
+
+// FSpriterPose
+
+void FSpriterPose::SetNum(int32 NumSlots)
+{
+	X.SetNum(NumSlots, false);
+	Y.SetNum(NumSlots, false);
+	Angle.SetNum(NumSlots, false);
+	ScaleX.SetNum(NumSlots, false);
+	ScaleY.SetNum(NumSlots, false);
+	Alpha.SetNum(NumSlots, false);
+	Color.SetNum(NumSlots, false);
+	Sampled.Init(false, NumSlots);
+}
+
+void FSpriterPose::Empty()
+{
+	X.Empty();
+	Y.Empty();
+	Angle.Empty();
+	ScaleX.Empty();
+	ScaleY.Empty();
+	Alpha.Empty();
+	Color.Empty();
+	Sampled.Empty();
+}
+
+FLinearColor FSpriterPose::GetColor(int32 Slot) const
+{
+	const FLinearColor& Tint = Color[Slot];
+	return FLinearColor(Tint.R, Tint.G, Tint.B, Alpha[Slot]);
+}
+
+void FSpriterPose::SetSlot(int32 Slot, const FSpriterTransform2D& Transform, const FLinearColor& SlotColor)
+{
+	X[Slot] = Transform.X;
+	Y[Slot] = Transform.Y;
+	Angle[Slot] = Transform.Angle;
+	ScaleX[Slot] = Transform.ScaleX;
+	ScaleY[Slot] = Transform.ScaleY;
+	Alpha[Slot] = SlotColor.A;
+	Color[Slot] = SlotColor;
+	Sampled[Slot] = true;
+}
+
+
+// FSpriterPoseEvaluator
+
+void FSpriterPoseEvaluator::Evaluate(const TArray<FSpriterTimelineKeyPair>& KeyPairs, FSpriterPose& OutPose)
+{
+	const int32 NumSlots = FMath::Min(KeyPairs.Num(), OutPose.Num());
+
+	float* RESTRICT X = OutPose.X.GetData();
+	float* RESTRICT Y = OutPose.Y.GetData();
+	float* RESTRICT Angle = OutPose.Angle.GetData();
+	float* RESTRICT ScaleX = OutPose.ScaleX.GetData();
+	float* RESTRICT ScaleY = OutPose.ScaleY.GetData();
+	float* RESTRICT Alpha = OutPose.Alpha.GetData();
+	FLinearColor* RESTRICT Color = OutPose.Color.GetData();
+
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		const FSpriterTimelineKeyPair& Keys = KeyPairs[Slot];
+		if (!Keys.IsValid())
+		{
+			OutPose.Sampled[Slot] = false;
+			continue;
+		}
+
+		const FSpriterTransform2D& First = Keys.First->Transform;
+		const FSpriterTransform2D& Second = Keys.Second->Transform;
+		const FLinearColor& FirstColor = Keys.First->Info.Color;
+		const FLinearColor& SecondColor = Keys.Second->Info.Color;
+		const float T = Keys.Alpha;
+
+		X[Slot] = FMath::Lerp(First.X, Second.X, T);
+		Y[Slot] = FMath::Lerp(First.Y, Second.Y, T);
+		Angle[Slot] = FSpriterTransform2D::LerpAngle(First.Angle, Second.Angle, Keys.First->Spin, T);
+		ScaleX[Slot] = FMath::Lerp(First.ScaleX, Second.ScaleX, T);
+		ScaleY[Slot] = FMath::Lerp(First.ScaleY, Second.ScaleY, T);
+		Alpha[Slot] = FMath::Lerp(FirstColor.A, SecondColor.A, T);
+		Color[Slot] = FMath::Lerp<FLinearColor>(FirstColor, SecondColor, T);
+		OutPose.Sampled[Slot] = true;
+	}
+}
+
+void FSpriterPoseEvaluator::Blend(const FSpriterPose& From, float Weight, FSpriterPose& InOutPose)
+{
+	const int32 NumSlots = FMath::Min(From.Num(), InOutPose.Num());
+
+	float* RESTRICT X = InOutPose.X.GetData();
+	float* RESTRICT Y = InOutPose.Y.GetData();
+	float* RESTRICT Angle = InOutPose.Angle.GetData();
+	float* RESTRICT ScaleX = InOutPose.ScaleX.GetData();
+	float* RESTRICT ScaleY = InOutPose.ScaleY.GetData();
+	float* RESTRICT Alpha = InOutPose.Alpha.GetData();
+	FLinearColor* RESTRICT Color = InOutPose.Color.GetData();
+
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		if (!From.Sampled[Slot] || !InOutPose.Sampled[Slot])
+		{
+			continue;
+		}
+
+		X[Slot] = FMath::Lerp(X[Slot], From.X[Slot], Weight);
+		Y[Slot] = FMath::Lerp(Y[Slot], From.Y[Slot], Weight);
+		Angle[Slot] += FRotator::NormalizeAxis(From.Angle[Slot] - Angle[Slot]) * Weight;
+		ScaleX[Slot] = FMath::Lerp(ScaleX[Slot], From.ScaleX[Slot], Weight);
+		ScaleY[Slot] = FMath::Lerp(ScaleY[Slot], From.ScaleY[Slot], Weight);
+		Alpha[Slot] = FMath::Lerp(Alpha[Slot], From.Alpha[Slot], Weight);
+		Color[Slot] = FMath::Lerp<FLinearColor>(Color[Slot], From.Color[Slot], Weight);
+	}
+}
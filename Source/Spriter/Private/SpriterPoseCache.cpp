@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterPoseCache.h"
+
+
+// FSpriterPoseCacheKey
+
+FSpriterPoseCacheKey::FSpriterPoseCacheKey(const USpriterImportData* InImportData, const FSpriterAnimation* InAnimation, float InTimeMS, bool bInBaked)
+	: ImportData(InImportData)
+	, Animation(InAnimation)
+	, TimeMS(InTimeMS)
+	, bBaked(bInBaked)
+{
+}
+
+
+// FSpriterPoseCache
+
+FSpriterPoseCache& FSpriterPoseCache::Get()
+{
+	static FSpriterPoseCache Cache;
+	return Cache;
+}
+
+FSpriterPoseCache::FSpriterPoseCache()
+	: Frame(0)
+	, NumEntries(0)
+{
+}
+
+bool FSpriterPoseCache::Find(const FSpriterPoseCacheKey& Key, FSpriterPose& OutPose, TArray<FSpriterTimelineKeyPair>& OutKeyPairs, FSpriterMainlineKeyPair& OutMainlineKeyPair)
+{
+	FScopeLock ScopeLock(&Lock);
+	FlushIfStale();
+
+	const int32* EntryIndex = EntryIndices.Find(Key);
+	if (!EntryIndex)
+	{
+		Misses.Increment();
+		return false;
+	}
+
+	const FEntry& Entry = Entries[*EntryIndex];
+	OutPose = Entry.Pose;
+	OutKeyPairs = Entry.KeyPairs;
+	OutMainlineKeyPair = Entry.MainlineKeyPair;
+
+	Hits.Increment();
+	return true;
+}
+
+void FSpriterPoseCache::Add(const FSpriterPoseCacheKey& Key, const FSpriterPose& Pose, const TArray<FSpriterTimelineKeyPair>& KeyPairs, const FSpriterMainlineKeyPair& MainlineKeyPair)
+{
+	FScopeLock ScopeLock(&Lock);
+	FlushIfStale();
+
+	// Another Skeleton may have evaluated the same Pose in parallel
+	if (EntryIndices.Contains(Key))
+	{
+		return;
+	}
+
+	if (NumEntries == Entries.Num())
+	{
+		Entries.AddDefaulted();
+	}
+
+	FEntry& Entry = Entries[NumEntries];
+	Entry.Pose = Pose;
+	Entry.KeyPairs = KeyPairs;
+	Entry.MainlineKeyPair = MainlineKeyPair;
+
+	EntryIndices.Add(Key, NumEntries++);
+}
+
+void FSpriterPoseCache::ResetStats()
+{
+	Hits.Reset();
+	Misses.Reset();
+}
+
+void FSpriterPoseCache::FlushIfStale()
+{
+	if (Frame != GFrameCounter)
+	{
+		Frame = GFrameCounter;
+
+		EntryIndices.Reset();
+		NumEntries = 0;
+	}
+}
@@ -0,0 +1,306 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterRenderComponent.h"
+#include "PaperRenderSceneProxy.h"
+
+
+// Draw Calls on their way to the Scene Proxy, the Proxy swaps the records out and hands the Buffer back with the ones it drew before
+struct FSpriterDrawCallBuffer
+{
+	TArray<FSpriteDrawCallRecord> DrawCalls;
+
+	TArray<UMaterialInterface*> Materials;
+};
+
+// Keeps the Buffers the Scene Proxy is done with, so filling the next one reuses every record's vertex storage instead of allocating
+class FSpriterDrawCallRecycler
+{
+public:
+
+	~FSpriterDrawCallRecycler()
+	{
+		for (FSpriterDrawCallBuffer* Buffer : FreeBuffers)
+		{
+			delete Buffer;
+		}
+	}
+
+	// Returns a Buffer to fill, a new one only when every Buffer is still on its way to the renderer
+	FSpriterDrawCallBuffer* Acquire()
+	{
+		FScopeLock Lock(&CriticalSection);
+		return FreeBuffers.Num() > 0 ? FreeBuffers.Pop(false) : new FSpriterDrawCallBuffer();
+	}
+
+	void Release(FSpriterDrawCallBuffer* Buffer)
+	{
+		FScopeLock Lock(&CriticalSection);
+		FreeBuffers.Add(Buffer);
+	}
+
+private:
+
+	FCriticalSection CriticalSection;
+
+	TArray<FSpriterDrawCallBuffer*> FreeBuffers;
+};
+
+
+// Paper2D's Scene Proxy already knows how to draw a batch of Sprite Draw Calls with one Material, this one draws a batch per Material
+class FSpriterRenderSceneProxy : public FPaperRenderSceneProxy
+{
+public:
+
+	FSpriterRenderSceneProxy(const USpriterRenderComponent* InComponent, const TArray<UMaterialInterface*>& UsedMaterials, const TSharedPtr<FSpriterDrawCallRecycler, ESPMode::ThreadSafe>& InRecycler)
+		: FPaperRenderSceneProxy(InComponent)
+		, Recycler(InRecycler)
+		, NumSections(0)
+	{
+		// Slot 0 is only set when the Material is overridden on the Component
+		Material = InComponent->GetMaterial(0);
+		if (Material)
+		{
+			MaterialRelevance = Material->GetRelevance(GetScene().GetFeatureLevel());
+		}
+		else
+		{
+			for (UMaterialInterface* UsedMaterial : UsedMaterials)
+			{
+				if (UsedMaterial)
+				{
+					MaterialRelevance |= UsedMaterial->GetRelevance(GetScene().GetFeatureLevel());
+				}
+			}
+		}
+	}
+
+	// Takes the Draw Calls out of the Buffer and hands it back to the Recycler, called on the render thread or before the Proxy is handed to it
+	void SetDrawCalls_RenderThread(FSpriterDrawCallBuffer* Buffer)
+	{
+		TArray<FSpriteDrawCallRecord>& NewDrawCalls = Buffer->DrawCalls;
+		const TArray<UMaterialInterface*>& NewMaterials = Buffer->Materials;
+
+		// Consecutive Draw Calls sharing a Material become one section, which keeps the draw order across sections.
+		// Records are swapped in rather than copied, so the Buffer goes back holding the vertex storage of the ones drawn before
+		NumSections = 0;
+		int32 NumSectionDrawCalls = 0;
+		for (int32 DrawCallIndex = 0; DrawCallIndex < NewDrawCalls.Num(); ++DrawCallIndex)
+		{
+			UMaterialInterface* DrawCallMaterial = Material ? Material : (NewMaterials.IsValidIndex(DrawCallIndex) ? NewMaterials[DrawCallIndex] : nullptr);
+			if (NumSections == 0 || Sections[NumSections - 1].Material != DrawCallMaterial)
+			{
+				if (NumSections > 0)
+				{
+					Sections[NumSections - 1].DrawCalls.SetNum(NumSectionDrawCalls, false);
+				}
+
+				if (NumSections == Sections.Num())
+				{
+					Sections.AddDefaulted();
+				}
+
+				Sections[NumSections].Material = DrawCallMaterial;
+				NumSectionDrawCalls = 0;
+				++NumSections;
+			}
+
+			TArray<FSpriteDrawCallRecord>& SectionDrawCalls = Sections[NumSections - 1].DrawCalls;
+			if (NumSectionDrawCalls < SectionDrawCalls.Num())
+			{
+				Swap(SectionDrawCalls[NumSectionDrawCalls], NewDrawCalls[DrawCallIndex]);
+			}
+			else
+			{
+				SectionDrawCalls.Add(MoveTemp(NewDrawCalls[DrawCallIndex]));
+			}
+			++NumSectionDrawCalls;
+		}
+
+		if (NumSections > 0)
+		{
+			Sections[NumSections - 1].DrawCalls.SetNum(NumSectionDrawCalls, false);
+		}
+
+		Recycler->Release(Buffer);
+	}
+
+protected:
+
+	// FPaperRenderSceneProxy interface
+	virtual void GetDynamicMeshElementsForView(const FSceneView* View, int32 ViewIndex, bool bUseOverrideColor, const FLinearColor& OverrideColor, FMeshElementCollector& Collector) const override
+	{
+		for (int32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+		{
+			const FSection& Section = Sections[SectionIndex];
+			if (Section.Material)
+			{
+				GetBatchMesh(View, bUseOverrideColor, OverrideColor, Section.Material, Section.DrawCalls, ViewIndex, Collector);
+			}
+		}
+	}
+	// End of FPaperRenderSceneProxy interface
+
+	struct FSection
+	{
+		UMaterialInterface* Material;
+
+		TArray<FSpriteDrawCallRecord> DrawCalls;
+
+		FSection()
+			: Material(nullptr)
+		{
+		}
+	};
+
+	TSharedPtr<FSpriterDrawCallRecycler, ESPMode::ThreadSafe> Recycler;
+
+	// Only the first NumSections are drawn, the rest keep their storage for later updates
+	TArray<FSection> Sections;
+
+	int32 NumSections;
+};
+
+
+// Class's Initialization
+
+USpriterRenderComponent::USpriterRenderComponent()
+	: LocalBounds(ForceInit)
+	, DrawCallRecycler(MakeShareable(new FSpriterDrawCallRecycler()))
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	bCastDynamicShadow = false;
+	bUseAsOccluder = false;
+}
+
+
+// Component Overrides
+
+FPrimitiveSceneProxy* USpriterRenderComponent::CreateSceneProxy()
+{
+	FSpriterRenderSceneProxy* NewProxy = new FSpriterRenderSceneProxy(this, UsedMaterials, DrawCallRecycler);
+	NewProxy->SetDrawCalls_RenderThread(FillDrawCallBuffer());
+
+	return NewProxy;
+}
+
+FBoxSphereBounds USpriterRenderComponent::CalcBounds(const FTransform& LocalToWorld) const
+{
+	if (LocalBounds.IsValid)
+	{
+		return FBoxSphereBounds(LocalBounds).TransformBy(LocalToWorld);
+	}
+
+	return FBoxSphereBounds(LocalToWorld.GetLocation(), FVector::ZeroVector, 0.f);
+}
+
+void USpriterRenderComponent::SendRenderDynamicData_Concurrent()
+{
+	Super::SendRenderDynamicData_Concurrent();
+
+	if (SceneProxy)
+	{
+		// Only the Buffer's pointer goes into the command, the Scene Proxy owns it until it's recycled
+		FSpriterDrawCallBuffer* Buffer = FillDrawCallBuffer();
+
+		ENQUEUE_UNIQUE_RENDER_COMMAND_TWOPARAMETER(
+			FSendSpriterDrawCalls,
+			FSpriterRenderSceneProxy*, InSceneProxy, (FSpriterRenderSceneProxy*)SceneProxy,
+			FSpriterDrawCallBuffer*, InBuffer, Buffer,
+		{
+			InSceneProxy->SetDrawCalls_RenderThread(InBuffer);
+		});
+	}
+}
+
+int32 USpriterRenderComponent::GetNumMaterials() const
+{
+	return 1;
+}
+
+
+// Gameplay Methods
+
+void USpriterRenderComponent::SetDrawCalls(TArray<FSpriteDrawCallRecord>& NewDrawCalls, TArray<UMaterialInterface*>& NewMaterials)
+{
+	check(NewDrawCalls.Num() == NewMaterials.Num());
+
+	Exchange(DrawCalls, NewDrawCalls);
+	Exchange(DrawCallMaterials, NewMaterials);
+
+	MarkDrawCallsDirty();
+}
+
+void USpriterRenderComponent::BuildDrawCall(FSpriteDrawCallRecord& OutDrawCall, UPaperSprite* Sprite, const FSpriterFatTimelineKey& Key, const FSpriterTransform2D& Transform, const FLinearColor& Color)
+{
+	OutDrawCall.BuildFromSprite(Sprite);
+	OutDrawCall.Color = Color.ToFColor(false);
+
+	// Baked vertices are relative to the Sprite asset's Pivot, the Key's Pivot Offset moves them onto the Key's Pivot
+	const FVector2D& PivotOffset = Key.PivotOffset;
+
+	FVector2D AxisX;
+	FVector2D AxisY;
+	Transform.GetAxes(AxisX, AxisY);
+	const FVector2D Origin = FVector2D(Transform.X, Transform.Y) + (AxisX * PivotOffset.X) + (AxisY * PivotOffset.Y);
+
+	OutDrawCall.Destination = FVector::ZeroVector;
+	for (FVector4& Vert : OutDrawCall.RenderVerts)
+	{
+		const FVector2D Position = Origin + (AxisX * Vert.X) + (AxisY * Vert.Y);
+		Vert.X = Position.X;
+		Vert.Y = Position.Y;
+	}
+}
+
+FSpriterDrawCallBuffer* USpriterRenderComponent::FillDrawCallBuffer()
+{
+	FSpriterDrawCallBuffer* Buffer = DrawCallRecycler->Acquire();
+
+	// Assigning over the recycled records reuses their vertex storage, only growing allocates
+	Buffer->DrawCalls.SetNum(DrawCalls.Num(), false);
+	for (int32 DrawCallIndex = 0; DrawCallIndex < DrawCalls.Num(); ++DrawCallIndex)
+	{
+		Buffer->DrawCalls[DrawCallIndex] = DrawCalls[DrawCallIndex];
+	}
+
+	Buffer->Materials.SetNumUninitialized(DrawCallMaterials.Num(), false);
+	for (int32 DrawCallIndex = 0; DrawCallIndex < DrawCallMaterials.Num(); ++DrawCallIndex)
+	{
+		Buffer->Materials[DrawCallIndex] = DrawCallMaterials[DrawCallIndex];
+	}
+
+	return Buffer;
+}
+
+void USpriterRenderComponent::MarkDrawCallsDirty()
+{
+	// A Material the Scene Proxy hasnt seen yet changes its relevance, so the Proxy is created again
+	bool bNewMaterial = false;
+	for (UMaterialInterface* DrawCallMaterial : DrawCallMaterials)
+	{
+		if (DrawCallMaterial && !UsedMaterials.Contains(DrawCallMaterial))
+		{
+			UsedMaterials.Add(DrawCallMaterial);
+			bNewMaterial = true;
+		}
+	}
+
+	if (bNewMaterial)
+	{
+		MarkRenderStateDirty();
+	}
+
+	LocalBounds = FBox(ForceInit);
+	for (const FSpriteDrawCallRecord& DrawCall : DrawCalls)
+	{
+		for (const FVector4& Vert : DrawCall.RenderVerts)
+		{
+			LocalBounds += DrawCall.Destination + (PaperAxisX * Vert.X) + (PaperAxisY * Vert.Y);
+		}
+	}
+
+	UpdateBounds();
+	MarkRenderTransformDirty();
+	MarkRenderDynamicDataDirty();
+}
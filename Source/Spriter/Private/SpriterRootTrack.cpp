@@ -0,0 +1,110 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterRootTrack.h"
+#include "SpriterPose.h"
+#include "SpriterCurve.h"
+
+
+// FSpriterRootTrack
+
+FSpriterRootTrack::FSpriterRootTrack()
+	: SampleRate(0.f)
+	, NumSamples(0)
+	, LengthInMS(0)
+{
+}
+
+void FSpriterRootTrack::Build(FSpriterAnimation& Animation, const FString& BoneName, float InSampleRate)
+{
+	SampleRate = InSampleRate;
+	LengthInMS = Animation.LengthInMS;
+	NumSamples = 0;
+	Samples.Empty();
+
+	FSpriterTimeline* Timeline = Animation.Timelines.FindByPredicate([&BoneName](const FSpriterTimeline& Candidate)
+	{
+		return Candidate.ObjectType == ESpriterObjectType::Bone && Candidate.Name == BoneName;
+	});
+
+	if (!Timeline || Timeline->Keys.Num() == 0 || SampleRate <= 0.f)
+	{
+		return;
+	}
+
+	NumSamples = FMath::CeilToInt((LengthInMS * SampleRate) / 1000.f) + 1;
+	Samples.SetNumUninitialized(NumSamples);
+
+	// Same Key search and Pose evaluator as Baking, for a single Timeline
+	int32 MainlineCursor = INDEX_NONE;
+	int32 TimelineCursor = INDEX_NONE;
+
+	TArray<FSpriterTimelineKeyPair> KeyPairs;
+	KeyPairs.SetNum(1);
+
+	FSpriterPose Pose;
+	Pose.SetNum(1);
+
+	for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+	{
+		const float TimeMS = GetSampleTimeMS(SampleIndex);
+
+		const int32 MainlineKey = FSpriterPlaybackCursor::FindKey(Animation.MainlineKeys, TimeMS, MainlineCursor);
+		const float EasedTimeMS = FSpriterCurve::EaseMainlineTime(Animation, MainlineKey, TimeMS);
+
+		FSpriterTimelineKeyPair& Keys = KeyPairs[0];
+		Keys.Reset();
+
+		const int32 Key = FSpriterPlaybackCursor::FindKey(Timeline->Keys, EasedTimeMS, TimelineCursor);
+		if (Key != INDEX_NONE)
+		{
+			Keys.First = &Timeline->Keys[Key];
+			Keys.Second = &Timeline->Keys[(Key + 1) % Timeline->Keys.Num()];
+			Keys.Alpha = FSpriterPlaybackCursor::GetPlayingAlpha(EasedTimeMS, Keys.First->TimeInMS, Keys.Second->TimeInMS, LengthInMS);
+			Keys.Alpha = FSpriterCurve::EaseTimelineAlpha(*Keys.First, Keys.Alpha);
+		}
+
+		FSpriterPoseEvaluator::Evaluate(KeyPairs, Pose);
+
+		// Before the Bone's first Key it holds still, so no motion is extracted there
+		if (!Pose.IsSampled(0))
+		{
+			Samples[SampleIndex] = (SampleIndex > 0) ? Samples[SampleIndex - 1] : FVector(Timeline->Keys[0].Transform.X, Timeline->Keys[0].Transform.Y, Timeline->Keys[0].Transform.Angle);
+			continue;
+		}
+
+		float Angle = Pose.Angle[0];
+		if (SampleIndex > 0)
+		{
+			const float PreviousAngle = Samples[SampleIndex - 1].Z;
+			Angle = PreviousAngle + FMath::UnwindDegrees(Angle - PreviousAngle);
+		}
+
+		Samples[SampleIndex] = FVector(Pose.X[0], Pose.Y[0], Angle);
+	}
+}
+
+FVector FSpriterRootTrack::Evaluate(float TimeMS) const
+{
+	if (!IsValid())
+	{
+		return FVector::ZeroVector;
+	}
+
+	// The last Sample is clamped to the Animation's end, so it may be closer than a full Sample step
+	const int32 SampleIndex = FMath::Clamp(FMath::FloorToInt((TimeMS * SampleRate) / 1000.f), 0, NumSamples - 2);
+	const float FirstTimeMS = GetSampleTimeMS(SampleIndex);
+	const float SecondTimeMS = GetSampleTimeMS(SampleIndex + 1);
+	const float Alpha = (SecondTimeMS > FirstTimeMS) ? FMath::Clamp((TimeMS - FirstTimeMS) / (SecondTimeMS - FirstTimeMS), 0.f, 1.f) : 0.f;
+
+	return FMath::Lerp(Samples[SampleIndex], Samples[SampleIndex + 1], Alpha);
+}
+
+void FSpriterRootTrack::GetDelta(float StartMS, float EndMS, FVector2D& OutTranslation, float& OutRotation) const
+{
+	const FVector Start = Evaluate(StartMS);
+	const FVector End = Evaluate(EndMS);
+
+	OutTranslation = FVector2D(End.X - Start.X, End.Y - Start.Y);
+	OutRotation = End.Z - Start.Z;
+}
@@ -0,0 +1,354 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterSkeletonBinding.h"
+
+
+// FSpriterAnimationBinding
+
+FSpriterAnimationBinding::FSpriterAnimationBinding()
+	: NumObjects(0)
+{
+}
+
+int32 FSpriterAnimationBinding::GetRefIndex(int32 KeyIndex, int32 Slot) const
+{
+	const int32 Index = (KeyIndex * NumObjects) + Slot;
+	if (KeyIndex >= 0 && Slot >= 0 && Slot < NumObjects && MainlineRefs.IsValidIndex(Index))
+	{
+		return MainlineRefs[Index];
+	}
+
+	return INDEX_NONE;
+}
+
+int32 FSpriterAnimationBinding::GetTimelineObject(int32 TimelineIndex) const
+{
+	if (TimelineObjects.IsValidIndex(TimelineIndex))
+	{
+		return TimelineObjects[TimelineIndex];
+	}
+
+	return INDEX_NONE;
+}
+
+
+// FSpriterSkeletonBinding
+
+FSpriterSkeletonBinding::FSpriterSkeletonBinding()
+	: NumBones(0)
+	, NumSprites(0)
+	, NumBoxs(0)
+	, NumPoints(0)
+	, NumEvents(0)
+{
+}
+
+void FSpriterSkeletonBinding::Build(const FSpriterEntity& Entity)
+{
+	TArray<FString> NewBoneNames;
+	TArray<FString> NewSpriteNames;
+	TArray<FString> NewBoxNames;
+	TArray<FString> NewPointNames;
+	TArray<FString> NewEventNames;
+
+	for (const FSpriterObjectInfo& Obj : Entity.Objects)
+	{
+		if (Obj.ObjectType == ESpriterObjectType::Bone)
+		{
+			NewBoneNames.Add(Obj.Name);
+		}
+		else if (Obj.ObjectType == ESpriterObjectType::Box)
+		{
+			NewBoxNames.Add(Obj.Name);
+		}
+		else if (Obj.ObjectType == ESpriterObjectType::Event)
+		{
+			NewEventNames.Add(Obj.Name);
+		}
+	}
+
+	// Spriter doesnt export Sprites or Points to the Object Info array, so they're searched for in all Timelines
+	for (const FSpriterAnimation& Animation : Entity.Animations)
+	{
+		for (const FSpriterTimeline& Timeline : Animation.Timelines)
+		{
+			if (Timeline.ObjectType == ESpriterObjectType::Sprite)
+			{
+				NewSpriteNames.AddUnique(Timeline.Name);
+			}
+			else if (Timeline.ObjectType == ESpriterObjectType::Point)
+			{
+				NewPointNames.AddUnique(Timeline.Name);
+			}
+		}
+	}
+
+	Build(Entity, NewBoneNames, NewSpriteNames, NewBoxNames, NewPointNames, NewEventNames);
+
+	// Store Bones Parent before Child, so World Transforms are composed in a single pass without lagging a frame behind
+	if (!AreBonesSorted())
+	{
+		TArray<int32> BoneOrder;
+		GetSortedBoneOrder(BoneOrder);
+
+		TArray<FString> SortedBoneNames;
+		SortedBoneNames.Reserve(BoneOrder.Num());
+		for (int32 BoneIndex : BoneOrder)
+		{
+			SortedBoneNames.Add(NewBoneNames[BoneIndex]);
+		}
+
+		Build(Entity, SortedBoneNames, NewSpriteNames, NewBoxNames, NewPointNames, NewEventNames);
+	}
+}
+
+void FSpriterSkeletonBinding::Build(const FSpriterEntity& Entity, const TArray<FString>& InBoneNames, const TArray<FString>& InSpriteNames, const TArray<FString>& InBoxNames, const TArray<FString>& InPointNames, const TArray<FString>& InEventNames)
+{
+	Reset();
+
+	BoneNames = InBoneNames;
+	SpriteNames = InSpriteNames;
+	BoxNames = InBoxNames;
+	PointNames = InPointNames;
+	EventNames = InEventNames;
+
+	NumBones = BoneNames.Num();
+	NumSprites = SpriteNames.Num();
+	NumBoxs = BoxNames.Num();
+	NumPoints = PointNames.Num();
+	NumEvents = EventNames.Num();
+
+	const int32 NumObjects = GetNumObjects();
+
+	// Name lookups only ever happen here, FString keys compare case insensitive like the rest of the Plugin
+	TMap<FString, int32> BoneSlots;
+	TMap<FString, int32> SpriteSlots;
+	TMap<FString, int32> BoxSlots;
+	TMap<FString, int32> PointSlots;
+	TMap<FString, int32> EventIndices;
+
+	for (int32 Index = 0; Index < NumBones; ++Index)
+	{
+		BoneSlots.Add(BoneNames[Index], GetBoneSlot(Index));
+	}
+	for (int32 Index = 0; Index < NumSprites; ++Index)
+	{
+		SpriteSlots.Add(SpriteNames[Index], GetSpriteSlot(Index));
+	}
+	for (int32 Index = 0; Index < NumBoxs; ++Index)
+	{
+		BoxSlots.Add(BoxNames[Index], GetBoxSlot(Index));
+	}
+	for (int32 Index = 0; Index < NumPoints; ++Index)
+	{
+		PointSlots.Add(PointNames[Index], GetPointSlot(Index));
+	}
+	for (int32 Index = 0; Index < NumEvents; ++Index)
+	{
+		EventIndices.Add(EventNames[Index], Index);
+	}
+
+	BoneParents.Init(INDEX_NONE, NumBones);
+	Animations.SetNum(Entity.Animations.Num());
+
+	for (int32 AnimationIndex = 0; AnimationIndex < Entity.Animations.Num(); ++AnimationIndex)
+	{
+		const FSpriterAnimation& Animation = Entity.Animations[AnimationIndex];
+		FSpriterAnimationBinding& AnimationBinding = Animations[AnimationIndex];
+
+		AnimationBinding.NumObjects = NumObjects;
+		AnimationBinding.ObjectTimelines.Init(INDEX_NONE, NumObjects);
+		AnimationBinding.EventLines.Init(INDEX_NONE, NumEvents);
+		AnimationBinding.TimelineObjects.Init(INDEX_NONE, Animation.Timelines.Num());
+		AnimationBinding.MainlineRefs.Init(INDEX_NONE, Animation.MainlineKeys.Num() * NumObjects);
+
+		// Bind Timelines to Objects
+		for (int32 TimelineIndex = 0; TimelineIndex < Animation.Timelines.Num(); ++TimelineIndex)
+		{
+			const FSpriterTimeline& Timeline = Animation.Timelines[TimelineIndex];
+			const TMap<FString, int32>* Slots = nullptr;
+
+			switch (Timeline.ObjectType)
+			{
+			case ESpriterObjectType::Bone:
+				Slots = &BoneSlots;
+				break;
+			case ESpriterObjectType::Sprite:
+				Slots = &SpriteSlots;
+				break;
+			case ESpriterObjectType::Box:
+				Slots = &BoxSlots;
+				break;
+			case ESpriterObjectType::Point:
+				Slots = &PointSlots;
+				break;
+			default:
+				break;
+			}
+
+			const int32* Slot = Slots ? Slots->Find(Timeline.Name) : nullptr;
+			if (Slot)
+			{
+				AnimationBinding.TimelineObjects[TimelineIndex] = *Slot;
+
+				// The first Timeline with a matching Name wins, same as a search by Name would
+				if (AnimationBinding.ObjectTimelines[*Slot] == INDEX_NONE)
+				{
+					AnimationBinding.ObjectTimelines[*Slot] = TimelineIndex;
+				}
+			}
+		}
+
+		// Bind Event Lines to Events
+		for (int32 EventLineIndex = 0; EventLineIndex < Animation.EventLines.Num(); ++EventLineIndex)
+		{
+			const int32* EventIndex = EventIndices.Find(Animation.EventLines[EventLineIndex].Name);
+			if (EventIndex && AnimationBinding.EventLines[*EventIndex] == INDEX_NONE)
+			{
+				AnimationBinding.EventLines[*EventIndex] = EventLineIndex;
+			}
+		}
+
+		// Bind Mainline Refs to Objects
+		for (int32 KeyIndex = 0; KeyIndex < Animation.MainlineKeys.Num(); ++KeyIndex)
+		{
+			const FSpriterMainlineKey& Key = Animation.MainlineKeys[KeyIndex];
+			int32* KeyRefs = &AnimationBinding.MainlineRefs[KeyIndex * NumObjects];
+
+			for (int32 RefIndex = 0; RefIndex < Key.BoneRefs.Num(); ++RefIndex)
+			{
+				const int32 Slot = AnimationBinding.GetTimelineObject(Key.BoneRefs[RefIndex].TimelineIndex);
+				if (SlotToBone(Slot) != INDEX_NONE && KeyRefs[Slot] == INDEX_NONE)
+				{
+					KeyRefs[Slot] = RefIndex;
+				}
+			}
+
+			for (int32 RefIndex = 0; RefIndex < Key.ObjectRefs.Num(); ++RefIndex)
+			{
+				const int32 Slot = AnimationBinding.GetTimelineObject(Key.ObjectRefs[RefIndex].TimelineIndex);
+				if (Slot >= NumBones && KeyRefs[Slot] == INDEX_NONE)
+				{
+					KeyRefs[Slot] = RefIndex;
+				}
+			}
+		}
+
+		// Setup Bones Static Parent from the first Mainline Key (The plugin doesnt currently support dynamiclly reparenting bones)
+		if (Animation.MainlineKeys.Num() > 0)
+		{
+			for (const FSpriterRef& BoneRef : Animation.MainlineKeys[0].BoneRefs)
+			{
+				const int32 BoneIndex = SlotToBone(AnimationBinding.GetTimelineObject(BoneRef.TimelineIndex));
+				const int32 ParentIndex = SlotToBone(AnimationBinding.GetTimelineObject(BoneRef.ParentTimelineIndex));
+
+				if (BoneIndex != INDEX_NONE && ParentIndex != INDEX_NONE && BoneParents[BoneIndex] == INDEX_NONE)
+				{
+					BoneParents[BoneIndex] = ParentIndex;
+				}
+			}
+		}
+	}
+}
+
+void FSpriterSkeletonBinding::Reset()
+{
+	NumBones = 0;
+	NumSprites = 0;
+	NumBoxs = 0;
+	NumPoints = 0;
+	NumEvents = 0;
+
+	BoneNames.Empty();
+	SpriteNames.Empty();
+	BoxNames.Empty();
+	PointNames.Empty();
+	EventNames.Empty();
+	BoneParents.Empty();
+	Animations.Empty();
+}
+
+bool FSpriterSkeletonBinding::IsBound() const
+{
+	return Animations.Num() > 0;
+}
+
+bool FSpriterSkeletonBinding::AreBonesSorted() const
+{
+	for (int32 BoneIndex = 0; BoneIndex < BoneParents.Num(); ++BoneIndex)
+	{
+		if (BoneParents[BoneIndex] >= BoneIndex)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FSpriterSkeletonBinding::GetSortedBoneOrder(TArray<int32>& OutOrder) const
+{
+	// Depth of each Bone below the Skeleton root, capped so a broken hierarchy with a cycle cant loop forever
+	TArray<int32> Depths;
+	Depths.Init(0, NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		int32 Depth = 0;
+		for (int32 ParentIndex = BoneParents[BoneIndex]; ParentIndex != INDEX_NONE && Depth < NumBones; ParentIndex = BoneParents[ParentIndex])
+		{
+			++Depth;
+		}
+
+		Depths[BoneIndex] = Depth;
+	}
+
+	OutOrder.SetNum(NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		OutOrder[BoneIndex] = BoneIndex;
+	}
+
+	OutOrder.StableSort([&Depths](int32 A, int32 B)
+	{
+		return Depths[A] < Depths[B];
+	});
+}
+
+const FSpriterAnimationBinding* FSpriterSkeletonBinding::GetAnimationBinding(const FSpriterEntity& Entity, const FSpriterAnimation* Animation) const
+{
+	if (Animation && Entity.Animations.Num() > 0)
+	{
+		const FSpriterAnimation* FirstAnimation = Entity.Animations.GetData();
+		if (Animation >= FirstAnimation && Animation < FirstAnimation + Entity.Animations.Num())
+		{
+			const int32 AnimationIndex = Animation - FirstAnimation;
+			if (Animations.IsValidIndex(AnimationIndex))
+			{
+				return &Animations[AnimationIndex];
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+SIZE_T FSpriterSkeletonBinding::GetAllocatedSize() const
+{
+	SIZE_T Size = BoneNames.GetAllocatedSize() + SpriteNames.GetAllocatedSize() + BoxNames.GetAllocatedSize() + PointNames.GetAllocatedSize() + EventNames.GetAllocatedSize();
+	Size += BoneParents.GetAllocatedSize() + Animations.GetAllocatedSize();
+
+	for (const FSpriterAnimationBinding& AnimationBinding : Animations)
+	{
+		Size += AnimationBinding.ObjectTimelines.GetAllocatedSize() + AnimationBinding.EventLines.GetAllocatedSize();
+		Size += AnimationBinding.TimelineObjects.GetAllocatedSize() + AnimationBinding.MainlineRefs.GetAllocatedSize();
+	}
+
+	return Size;
+}
+
+const FSpriterSkeletonBinding& FSpriterSkeletonBinding::GetEmpty()
+{
+	static const FSpriterSkeletonBinding EmptyBinding;
+	return EmptyBinding;
+}
\ No newline at end of file
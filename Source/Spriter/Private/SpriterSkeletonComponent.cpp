@@ -2,12 +2,84 @@
 
 #include "SpriterPrivatePCH.h"
 #include "SpriterSkeletonComponent.h"
+#include "SpriterCurve.h"
+#include "SpriterAnimationManager.h"
 
 
 // Static's Initialization
 const float USpriterSkeletonComponent::SPRITER_ZOFFSET = 2.0f;
 
 
+// Helpers
+
+// Samples and composes a Skeleton on a worker thread
+class FSpriterEvaluationTask
+{
+	USpriterSkeletonComponent* Component;
+
+public:
+	FSpriterEvaluationTask(USpriterSkeletonComponent* InComponent)
+		: Component(InComponent)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FSpriterEvaluationTask, STATGROUP_TaskGraphTasks);
+	}
+
+	static ENamedThreads::Type GetDesiredThread() { return ENamedThreads::AnyThread; }
+
+	static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::TrackSubsequents; }
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		Component->EvaluateSkeleton();
+	}
+};
+
+// Applies an evaluated Skeleton to its Sprite Components and fires its delegates, back on the game thread
+class FSpriterEvaluationCompletionTask
+{
+	USpriterSkeletonComponent* Component;
+
+	float DeltaTime;
+
+public:
+	FSpriterEvaluationCompletionTask(USpriterSkeletonComponent* InComponent, float InDeltaTime)
+		: Component(InComponent)
+		, DeltaTime(InDeltaTime)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FSpriterEvaluationCompletionTask, STATGROUP_TaskGraphTasks);
+	}
+
+	static ENamedThreads::Type GetDesiredThread() { return ENamedThreads::GameThread; }
+
+	static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::TrackSubsequents; }
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		Component->ApplySkeleton();
+		Component->AdvanceAnimation(DeltaTime);
+	}
+};
+
+template<typename InstanceType>
+static void SetInstanceParentBone(InstanceType& Instance, int32 ParentBoneIndex, const TArray<FSpriterBoneInstance>& Bones)
+{
+	// Only touch the Name when the Parent actually changes, so reparenting stays allocation free
+	if (Instance.ParentBoneIndex != ParentBoneIndex)
+	{
+		Instance.ParentBoneIndex = ParentBoneIndex;
+		Instance.ParentBoneName = Bones.IsValidIndex(ParentBoneIndex) ? Bones[ParentBoneIndex].Name : FString();
+	}
+}
+
+
 // Class's Initialization
 
 USpriterSkeletonComponent::USpriterSkeletonComponent()
@@ -17,6 +89,44 @@ USpriterSkeletonComponent::USpriterSkeletonComponent()
 	bWantsBeginPlay = true;
 	PrimaryComponentTick.bCanEverTick = true;
 
+	bUseBakedAnimations = true;
+	bParallelEvaluation = false;
+	bBatchSprites = false;
+	PushTolerance = 0.001f;
+	MaxPooledSpriteComponents = 64;
+	EventTimeMS = -1.f;
+	EventAnimation = nullptr;
+	bUsePoseCache = false;
+	bBlendFromSnapshot = true;
+	ActiveBlendSpace = nullptr;
+	BlendSpaceInput = FVector2D::ZeroVector;
+	bExtractRootMotion = false;
+	RootMotionTranslation = FVector2D::ZeroVector;
+	RootMotionRotation = 0.f;
+	RootBoneSlot = INDEX_NONE;
+	bBlendingFromSnapshot = false;
+	PoseCacheQuantumMS = 1000.f / 60.f;
+	bEnableUpdateLOD = false;
+	HiddenTimeout = 0.5f;
+	bUpdateGameplayWhenHidden = true;
+	ReducedDistance = 0.f;
+	ReducedUpdateRate = 10.f;
+	CurrentUpdateLOD = ESpriterUpdateLOD::FULL;
+	bEvaluateThisFrame = true;
+	TimeSinceEvaluation = 0.f;
+	EasedTimeMS = 0.f;
+	ResolvedCharacterMap = nullptr;
+	ResolvedSkeleton = nullptr;
+	ResolvedChangeCount = INDEX_NONE;
+	NumPushedUpdates = 0;
+	NumSkippedUpdates = 0;
+	RenderComponent = nullptr;
+	Binding = &FSpriterSkeletonBinding::GetEmpty();
+
+	bUseAnimationManager = false;
+	AnimationTickGroup = TG_PrePhysics;
+	AnimationPriority = 0;
+
 	Owner = GetOwner();
 
 	// ...
@@ -26,6 +136,7 @@ FSpriterBoneInstance::FSpriterBoneInstance()
 	: IsActive(true)
 	, Name("")
 	, ParentBoneName("")
+	, ParentBoneIndex(INDEX_NONE)
 	, RelativeTransform()
 	, WorldTransform()
 {
@@ -35,10 +146,23 @@ FSpriterSpriteInstance::FSpriterSpriteInstance()
 	: IsActive(true)
 	, Name("")
 	, ParentBoneName("")
+	, ParentBoneIndex(INDEX_NONE)
 	, RelativeTransform()
 	, WorldTransform()
 	, ZIndex(0)
+	, RelativeTransform2D()
+	, WorldTransform2D()
 	, SpriteComponent(nullptr)
+	, PivotedTransform2D()
+	, EvaluatedColor(FLinearColor::White)
+	, EvaluatedKey(nullptr)
+	, bPushed(false)
+	, bPushedActive(false)
+	, PushedZIndex(0)
+	, PushedTransform2D()
+	, PushedColor(FLinearColor::White)
+	, PushedSprite(nullptr)
+	, PushedKey(nullptr)
 {
 }
 
@@ -46,6 +170,7 @@ FSpriterBoxInstance::FSpriterBoxInstance()
 	: IsActive(true)
 	, Name("")
 	, ParentBoneName("")
+	, ParentBoneIndex(INDEX_NONE)
 	, RelativeTransform()
 	, WorldTransform()
 	, ZIndex(0)
@@ -56,6 +181,7 @@ FSpriterPointInstance::FSpriterPointInstance()
 	: IsActive(true)
 	, Name("")
 	, ParentBoneName("")
+	, ParentBoneIndex(INDEX_NONE)
 	, RelativeTransform()
 	, WorldTransform()
 	, ZIndex(0)
@@ -68,6 +194,17 @@ FSpriterEventInstance::FSpriterEventInstance()
 {
 }
 
+FSpriterAnimationLayer::FSpriterAnimationLayer()
+	: AnimationName("")
+	, TimeMS(0.f)
+	, PlayRate(1.f)
+	, Weight(1.f)
+	, BlendMode(ESpriterLayerBlendMode::OVERRIDE)
+	, Animation(nullptr)
+	, bReferencePoseValid(false)
+{
+}
+
 
 // Component Overrides
 
@@ -77,7 +214,38 @@ void USpriterSkeletonComponent::BeginPlay()
 
 	// Init our default Skeleton
 	IsInitialized(true);
+
+	if (bUseAnimationManager && GetWorld())
+	{
+		PrimaryComponentTick.SetTickFunctionEnable(false);
+		FSpriterAnimationManager::Get(GetWorld()).Register(this);
+	}
+}
+
+void USpriterSkeletonComponent::OnUnregister()
+{
+	FSpriterAnimationManager* Manager = FSpriterAnimationManager::Find(GetWorld());
+	if (Manager)
+	{
+		Manager->Unregister(this);
+	}
+
+	Super::OnUnregister();
+}
+
+#if WITH_EDITOR
+void USpriterSkeletonComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	const FName PropertyName = PropertyChangedEvent.Property ? PropertyChangedEvent.Property->GetFName() : NAME_None;
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(USpriterSkeletonComponent, bUseAnimationManager) || PropertyName == GET_MEMBER_NAME_CHECKED(USpriterSkeletonComponent, AnimationTickGroup) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(USpriterSkeletonComponent, AnimationPriority))
+	{
+		SetAnimationManager(bUseAnimationManager, AnimationTickGroup, AnimationPriority);
+	}
 }
+#endif
 
 void USpriterSkeletonComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
@@ -85,78 +253,191 @@ void USpriterSkeletonComponent::TickComponent(float DeltaTime, ELevelTick TickTy
 
 	if (IsInitialized(true) && AnimationState != ESpriterAnimationState::NONE)
 	{
-		// Update all Objects
+		UpdateLOD(DeltaTime);
 
-		UpdateBones();
-		UpdateSprites();
-		if (AnimationState == ESpriterAnimationState::PLAYING)
+		// Ticks without a Tick Function (called directly) have nothing to hold the Tasks to, so they evaluate inline
+		if (bEvaluateThisFrame && bParallelEvaluation && ThisTickFunction && FApp::ShouldUseThreadingForPerformance())
+		{
+			// Sample and compose on a worker thread, then apply on the game thread before this tick counts as complete
+			FGraphEventArray Prerequisites;
+			Prerequisites.Add(TGraphTask<FSpriterEvaluationTask>::CreateTask(nullptr, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(this));
+
+			FGraphEventRef CompletionEvent = TGraphTask<FSpriterEvaluationCompletionTask>::CreateTask(&Prerequisites, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(this, DeltaTime);
+			ThisTickFunction->GetCompletionHandle()->DontCompleteUntil(CompletionEvent);
+		}
+		else
 		{
-			UpdateBoxs();
-			UpdatePoints();
-			UpdateEvents();
+			EvaluateSkeleton();
+			ApplySkeleton();
+			AdvanceAnimation(DeltaTime);
 		}
+	}
+}
+
+void USpriterSkeletonComponent::UpdateLOD(float DeltaTime)
+{
+	CurrentUpdateLOD = ESpriterUpdateLOD::FULL;
+	bEvaluateThisFrame = true;
+
+	if (!bEnableUpdateLOD)
+	{
+		return;
+	}
 
+	if (!WasRecentlyRendered(HiddenTimeout))
+	{
+		CurrentUpdateLOD = ESpriterUpdateLOD::HIDDEN;
+		bEvaluateThisFrame = bUpdateGameplayWhenHidden;
+	}
+	else if (ReducedDistance > 0.f && GetDistanceToClosestCamera() > ReducedDistance)
+	{
+		CurrentUpdateLOD = ESpriterUpdateLOD::REDUCED;
 
-		// Update Animation State
+		TimeSinceEvaluation += DeltaTime;
+		bEvaluateThisFrame = (TimeSinceEvaluation >= (1.f / FMath::Max(ReducedUpdateRate, 1.f)));
+	}
 
-		if (AnimationState == ESpriterAnimationState::BLENDING)
-		{
-			CurrentBlendTimeMS = FMath::Min<int32>(BlendDurationMS, (CurrentBlendTimeMS + ToMS(DeltaTime)));
+	if (bEvaluateThisFrame)
+	{
+		TimeSinceEvaluation = 0.f;
+	}
+}
+
+void USpriterSkeletonComponent::EvaluateSkeleton()
+{
+	if (!bEvaluateThisFrame)
+	{
+		return;
+	}
+
+	UpdatePose();
+	UpdateBones();
+	if (CurrentUpdateLOD != ESpriterUpdateLOD::HIDDEN)
+	{
+		EvaluateSprites();
+	}
+	if (AnimationState == ESpriterAnimationState::PLAYING)
+	{
+		UpdateBoxs();
+		UpdatePoints();
+	}
+}
+
+void USpriterSkeletonComponent::ApplySkeleton()
+{
+	if (bEvaluateThisFrame && CurrentUpdateLOD != ESpriterUpdateLOD::HIDDEN)
+	{
+		ApplySprites();
+	}
+	if (AnimationState == ESpriterAnimationState::PLAYING)
+	{
+		UpdateEvents();
+	}
+}
+
+void USpriterSkeletonComponent::AdvanceAnimation(float DeltaTime)
+{
+	AdvanceLayers(DeltaTime);
+
+	RootMotionTranslation = FVector2D::ZeroVector;
+	RootMotionRotation = 0.f;
 
-			if (ActiveAnimation && NextAnimation)
+	if (AnimationState == ESpriterAnimationState::BLENDING)
+	{
+		CurrentBlendTimeMS = FMath::Min<int32>(BlendDurationMS, (CurrentBlendTimeMS + ToMS(DeltaTime)));
+
+		if (ActiveAnimation && NextAnimation)
+		{
+			if (CurrentBlendTimeMS >= BlendDurationMS)
 			{
-				if (CurrentBlendTimeMS >= BlendDurationMS)
-				{
-					CurrentTimeMS = 0.f;
-					CurrentBlendTimeMS = 0.f;
-					BlendDurationMS = 0.f;
-					ActiveAnimation = NextAnimation;
-					NextAnimation = nullptr;
-					AnimationState = ESpriterAnimationState::PLAYING;
+				CurrentTimeMS = 0.f;
+				CurrentBlendTimeMS = 0.f;
+				BlendDurationMS = 0.f;
+				ActiveAnimation = NextAnimation;
+				NextAnimation = nullptr;
+				AnimationState = ESpriterAnimationState::PLAYING;
 
-					bFirstTime = true;
+				bFirstTime = true;
 
-					return;
-				}
+				return;
 			}
 		}
-		else if (AnimationState == ESpriterAnimationState::PLAYING)
+	}
+	else if (AnimationState == ESpriterAnimationState::PLAYING)
+	{
+		if (bBlendingFromSnapshot)
 		{
-			if (ActiveAnimation)
+			CurrentBlendTimeMS = FMath::Min(BlendDurationMS, (CurrentBlendTimeMS + ToMS(DeltaTime)));
+			if (CurrentBlendTimeMS >= BlendDurationMS)
+			{
+				CurrentBlendTimeMS = 0.f;
+				BlendDurationMS = 0.f;
+				bBlendingFromSnapshot = false;
+			}
+		}
+
+		if (ActiveAnimation)
+		{
+			if (CurrentTimeMS == 0)
 			{
-				if (CurrentTimeMS == 0)
+				// Broadcasting copies the Animation into the parameters, even when nothing listens
+				if (OnAnimationStarted.IsBound())
 				{
 					OnAnimationStarted.Broadcast(this, *ActiveAnimation, bFirstTime);
-
-					bFirstTime = false;
 				}
+
+				bFirstTime = false;
 			}
 
-			CurrentTimeMS = FMath::Min<int32>(ActiveAnimation->LengthInMS, (CurrentTimeMS + ToMS(DeltaTime)));
+			const float StartTimeMS = CurrentTimeMS;
+			CurrentTimeMS = FMath::Min<int32>(ActiveAnimation->LengthInMS, (CurrentTimeMS + ToMS(DeltaTime * GetBlendSpaceTimeScale())));
 
-			if (ActiveAnimation)
+			// Time stops at the end before a Loop restarts it, so the motion never has to wrap
+			const FSpriterRootTrack* RootTrack = (bExtractRootMotion && Skeleton) ? Skeleton->GetRootTrack(ActiveAnimation) : nullptr;
+			if (RootTrack)
 			{
-				if (CurrentTimeMS >= ActiveAnimation->LengthInMS)
+				RootTrack->GetDelta(StartTimeMS, CurrentTimeMS, RootMotionTranslation, RootMotionRotation);
+			}
+
+			if (CurrentTimeMS >= ActiveAnimation->LengthInMS)
+			{
+				// Fire the Events between the last Update and the end, before the Loop or End resets the window
+				if (EventAnimation == ActiveAnimation)
 				{
-					if (ActiveAnimation->bIsLooping)
+					const FSpriterAnimation* EndingAnimation = ActiveAnimation;
+					QueueEvents(EventTimeMS, ActiveAnimation->LengthInMS);
+					BroadcastPendingEvents();
+
+					// An Event may have started another Animation already
+					if (ActiveAnimation != EndingAnimation)
 					{
-						CurrentTimeMS = 0;
+						return;
+					}
+				}
+
+				if (ActiveAnimation->bIsLooping)
+				{
+					CurrentTimeMS = 0;
 
+					if (OnAnimationEnded.IsBound())
+					{
 						OnAnimationEnded.Broadcast(this, *ActiveAnimation, false);
-						CleanupObjectData();
 					}
-					else
-					{
-						AnimationState = ESpriterAnimationState::NONE;
+					CleanupObjectData();
+				}
+				else
+				{
+					AnimationState = ESpriterAnimationState::NONE;
 
+					if (OnAnimationEnded.IsBound())
+					{
 						OnAnimationEnded.Broadcast(this, *ActiveAnimation, false);
-						CleanupObjectData();
 					}
+					CleanupObjectData();
 				}
 			}
 		}
 	}
-
 }
 
 
@@ -189,51 +470,39 @@ void USpriterSkeletonComponent::InitSkeleton()
 {
 	if (Skeleton)
 	{
+		// Keys need their cached Unreal Unit data before anything can be evaluated
+		if (!Skeleton->HasDerivedData())
+		{
+			Skeleton->BuildDerivedData();
+		}
+
 		if (!ActiveEntity)
 		{
 			ActiveEntity = GetEntity(0);
 		}
 
-		// We do this because Spriter doesnt export Sprites or Points to the Object Info array, so we have to search for them in all Timelines
-		TArray<FString> SpritesToCreate = TArray<FString>();
-		TArray<FString> PointsToCreate = TArray<FString>();
-
 		if (ActiveEntity)
 		{
-			// Loop through Object Infos, and create Bones, Boxs, and Events
-			for (FSpriterObjectInfo& Obj : ActiveEntity->Objects)
+			// The Entity's Binding is built once with the Skeleton's derived data and shared, it already knows every Object to create
+			Binding = Skeleton->GetEntityBinding(ActiveEntity);
+			if (!Binding)
 			{
-				if (Obj.ObjectType == ESpriterObjectType::Bone)
-				{
-					FSpriterBoneInstance Bone = FSpriterBoneInstance();
-					Bone.Name = Obj.Name;
+				Binding = &FSpriterSkeletonBinding::GetEmpty();
+			}
 
-					// Setup Bones Static Parent (The plugin doesnt currently support dynamiclly reparenting bones)
-					for (FSpriterAnimation& Animation : ActiveEntity->Animations)
-					{
-						FSpriterRef* BoneRef = GetBoneRef(Animation, Animation.MainlineKeys[0], Obj.Name);
-
-						if (BoneRef)
-						{
-							if (BoneRef->ParentTimelineIndex != INDEX_NONE && BoneRef->TimelineIndex != INDEX_NONE)
-							{
-								FSpriterTimeline* Timeline = GetTimeline(Animation, BoneRef->TimelineIndex);
-								FSpriterTimeline* ParentTimeline = GetTimeline(Animation, BoneRef->ParentTimelineIndex);
-								if (Timeline && ParentTimeline)
-								{
-									if (Timeline->Name.Equals(Obj.Name, ESearchCase::IgnoreCase))
-									{
-										Bone.ParentBoneName = ParentTimeline->Name;
-										break;
-									}
-								}
-							}
-						}
-					}
+			// Create Bones in the Binding's order, which has Parents before their Children
+			for (const FString& BoneName : Binding->BoneNames)
+			{
+				FSpriterBoneInstance Bone = FSpriterBoneInstance();
+				Bone.Name = BoneName;
 
-					Bones.Add(Bone);
-				}
-				else if (Obj.ObjectType == ESpriterObjectType::Box)
+				Bones.Add(Bone);
+			}
+
+			// Loop through Object Infos, and create Boxs and Events
+			for (FSpriterObjectInfo& Obj : ActiveEntity->Objects)
+			{
+				if (Obj.ObjectType == ESpriterObjectType::Box)
 				{
 					FSpriterBoxInstance Box = FSpriterBoxInstance();
 					Box.Name = Obj.Name;
@@ -252,44 +521,76 @@ void USpriterSkeletonComponent::InitSkeleton()
 				}
 			}
 
-			// Loop Through all Timelines to find all Sprites and Points that need to be Created
-			for (FSpriterAnimation& Animation : ActiveEntity->Animations)
-			{
-				for (FSpriterTimeline& Timeline : Animation.Timelines)
-				{
-					if (Timeline.ObjectType == ESpriterObjectType::Sprite)
-					{
-						SpritesToCreate.AddUnique(Timeline.Name);
-					}
-					else if (Timeline.ObjectType == ESpriterObjectType::Point)
-					{
-						PointsToCreate.AddUnique(Timeline.Name);
-					}
-				}
-			}
-
 			// Create all needed Sprites 
-			for (FString& SpriteName : SpritesToCreate)
+			for (const FString& SpriteName : Binding->SpriteNames)
 			{
 				FSpriterSpriteInstance Sprite = FSpriterSpriteInstance();
 				Sprite.Name = SpriteName;
 
-				Sprite.SpriteComponent = NewObject<UPaperSpriteComponent>((UObject*)Owner, FName(*SpriteName));
-				Sprite.SpriteComponent->AttachTo(this);
-				Sprite.SpriteComponent->bWantsBeginPlay = true;
-				Sprite.SpriteComponent->RegisterComponent();
+				if (!bBatchSprites)
+				{
+					Sprite.SpriteComponent = AcquireSpriteComponent(SpriteName);
+				}
 
 				Sprites.Add(Sprite);
 			}
 
+			// Or a single Render Component for all of them
+			if (bBatchSprites && Sprites.Num() > 0)
+			{
+				RenderComponent = NewObject<USpriterRenderComponent>((UObject*)Owner);
+				RenderComponent->AttachTo(this);
+				RenderComponent->RegisterComponent();
+			}
+
 			// Create all needed Points
-			for (FString& PointName : PointsToCreate)
+			for (const FString& PointName : Binding->PointNames)
 			{
 				FSpriterPointInstance Point = FSpriterPointInstance();
 				Point.Name = PointName;
 
 				Points.Add(Point);
 			}
+
+			// Preallocate the Key and Pose storage for every Object, so Updating never allocates
+			TimelineKeyPairs.SetNum(Binding->GetNumObjects());
+			Pose.SetNum(Binding->GetNumObjects());
+
+			// A Snapshot of another Entity's slots means nothing here
+			bBlendingFromSnapshot = false;
+
+			RootBoneSlot = INDEX_NONE;
+			for (int32 BoneIndex = 0; BoneIndex < Bones.Num() && !Skeleton->RootBoneName.IsEmpty(); ++BoneIndex)
+			{
+				if (Bones[BoneIndex].Name == Skeleton->RootBoneName)
+				{
+					RootBoneSlot = Binding->GetBoneSlot(BoneIndex);
+					break;
+				}
+			}
+
+			// Setup Bones Static Parent (The plugin doesnt currently support dynamiclly reparenting bones)
+			for (int32 BoneIndex = 0; BoneIndex < Bones.Num(); ++BoneIndex)
+			{
+				const int32 ParentIndex = Binding->BoneParents[BoneIndex];
+				if (ParentIndex != INDEX_NONE)
+				{
+					Bones[BoneIndex].ParentBoneIndex = ParentIndex;
+					Bones[BoneIndex].ParentBoneName = Bones[ParentIndex].Name;
+				}
+			}
+
+			// Layers outlive the Entity they were added for, rebind them to this one
+			for (FSpriterAnimationLayer& Layer : Layers)
+			{
+				PrepareLayer(Layer);
+			}
+
+			for (FSpriterAnimationLayer& Player : BlendSpacePlayers)
+			{
+				PrepareLayer(Player);
+			}
+			UpdateBlendSpaceWeights();
 		}
 	}
 	else
@@ -301,6 +602,33 @@ void USpriterSkeletonComponent::InitSkeleton()
 
 // Gameplay Methods
 
+void USpriterSkeletonComponent::SetAnimationManager(bool bUseManager, ETickingGroup TickGroup, int32 Priority)
+{
+	bUseAnimationManager = bUseManager;
+	AnimationTickGroup = TickGroup;
+	AnimationPriority = Priority;
+
+	// Only playing Skeletons are registered, BeginPlay takes care of the rest.
+	// Registering again puts the Skeleton in its new Tick Group and sorts it by its new Priority
+	if (!HasBegunPlay() || !GetWorld())
+	{
+		return;
+	}
+
+	FSpriterAnimationManager* Manager = FSpriterAnimationManager::Find(GetWorld());
+	if (Manager)
+	{
+		Manager->Unregister(this);
+	}
+
+	if (bUseAnimationManager)
+	{
+		FSpriterAnimationManager::Get(GetWorld()).Register(this);
+	}
+
+	PrimaryComponentTick.SetTickFunctionEnable(!bUseAnimationManager);
+}
+
 void USpriterSkeletonComponent::SetSkeleton(USpriterImportData * NewSkeleton)
 {
 	if (!NewSkeleton || NewSkeleton == Skeleton)
@@ -314,6 +642,7 @@ void USpriterSkeletonComponent::SetSkeleton(USpriterImportData * NewSkeleton)
 	}
 
 	Skeleton = NewSkeleton;
+	ActiveEntity = nullptr;
 	InitSkeleton();
 }
 
@@ -324,6 +653,11 @@ void USpriterSkeletonComponent::SetActiveEntity(int32 EntityIndex)
 		FSpriterEntity* Entity = GetEntity(EntityIndex);
 		if (Entity && ActiveEntity != Entity)
 		{
+			if (IsInitialized(false))
+			{
+				CleanupObjects();
+			}
+
 			ActiveEntity = Entity;
 			InitSkeleton();
 		}
@@ -337,6 +671,11 @@ void USpriterSkeletonComponent::SetActiveEntityByName(const FString & EntityName
 		FSpriterEntity* Entity = GetEntity(EntityName);
 		if (Entity && ActiveEntity != Entity)
 		{
+			if (IsInitialized(false))
+			{
+				CleanupObjects();
+			}
+
 			ActiveEntity = Entity;
 			InitSkeleton();
 		}
@@ -350,6 +689,7 @@ void USpriterSkeletonComponent::SetCharacterMap(USpriterCharacterMap * Map)
 		if (Map != CharacterMap)
 		{
 			CharacterMap = Map;
+			ResolveCharacterMap();
 		}
 	}
 }
@@ -379,15 +719,73 @@ void USpriterSkeletonComponent::ApplyCharacterMap(USpriterCharacterMap * Map, bo
 			}
 		}
 
+		// The Map is shared, every other Skeleton and Crowd using it resolves again on its next lookup
+		CharacterMap->MarkEntrysChanged();
+		ResolveCharacterMap();
 		UpdateSprites();
 	}
 }
 
+void USpriterSkeletonComponent::ResolveCharacterMap()
+{
+	ResolvedSprites.Reset();
+	ResolvedCharacterMap = CharacterMap;
+	ResolvedSkeleton = Skeleton;
+	ResolvedChangeCount = CharacterMap ? CharacterMap->GetChangeCount() : INDEX_NONE;
+
+	if (Skeleton && CharacterMap)
+	{
+		if (!Skeleton->HasDerivedData())
+		{
+			Skeleton->BuildDerivedData();
+		}
+
+		CharacterMap->ResolveSprites(Skeleton->ImportedData, Skeleton->GetNumFiles(), ResolvedSprites);
+	}
+}
+
 void USpriterSkeletonComponent::PlayAnimation(const FString& AnimationName, float BlendLengthMS)
 {
 	if (IsInitialized(true) && !AnimationName.IsEmpty() && BlendLengthMS >= 0)
 	{
-		if(BlendLengthMS > 0)
+		// PlayBlendSpace sets it again right after
+		ActiveBlendSpace = nullptr;
+
+		if (BlendLengthMS > 0 && bBlendFromSnapshot)
+		{
+			// Resolve the target first, a missing Animation must not end the current one or leave a Blend towards nothing
+			FSpriterAnimation* TargetAnimation = GetAnimation(AnimationName);
+			if (!TargetAnimation)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("USpriterSkeletonComponent_PlayAnimation() : Couldnt Find Animation %s!"), *AnimationName);
+
+				return;
+			}
+
+			if (!ActiveAnimation)
+			{
+				SetToSetupPose();
+			}
+			else
+			{
+				OnAnimationEnded.Broadcast(this, *ActiveAnimation, true);
+				CleanupObjectData();
+			}
+
+			// The last Pose already holds any Blend in progress, so chained Blends cost the same as one
+			BlendSnapshot = Pose;
+
+			ActiveAnimation = TargetAnimation;
+			NextAnimation = nullptr;
+			CurrentTimeMS = 0.f;
+			CurrentBlendTimeMS = 0.f;
+			BlendDurationMS = BlendLengthMS;
+			AnimationState = ESpriterAnimationState::PLAYING;
+			bBlendingFromSnapshot = true;
+
+			bFirstTime = true;
+		}
+		else if (BlendLengthMS > 0)
 		{
 			if (!ActiveAnimation)
 			{
@@ -397,6 +795,7 @@ void USpriterSkeletonComponent::PlayAnimation(const FString& AnimationName, floa
 				CurrentBlendTimeMS = 0.f;
 				BlendDurationMS = BlendLengthMS;
 				AnimationState = ESpriterAnimationState::BLENDING;
+				bBlendingFromSnapshot = false;
 			}
 			else
 			{
@@ -404,6 +803,7 @@ void USpriterSkeletonComponent::PlayAnimation(const FString& AnimationName, floa
 				CurrentBlendTimeMS = 0.f;
 				BlendDurationMS = BlendLengthMS;
 				AnimationState = ESpriterAnimationState::BLENDING;
+				bBlendingFromSnapshot = false;
 
 				OnAnimationEnded.Broadcast(this, *ActiveAnimation, true);
 				CleanupObjectData();
@@ -423,6 +823,7 @@ void USpriterSkeletonComponent::PlayAnimation(const FString& AnimationName, floa
 			CurrentBlendTimeMS = 0.f;
 			BlendDurationMS = 0.f;
 			AnimationState = ESpriterAnimationState::PLAYING;
+			bBlendingFromSnapshot = false;
 
 			bFirstTime = true;
 		}
@@ -461,7 +862,10 @@ void USpriterSkeletonComponent::SetToSetupPose()
 		BlendDurationMS = 0.f;
 		CurrentTimeMS = 0.f;
 		ActiveAnimation = GetAnimation(0);
+		ActiveBlendSpace = nullptr;
+		bBlendingFromSnapshot = false;
 
+		UpdatePose();
 		UpdateBones();
 		UpdateSprites();
 		UpdateBoxs();
@@ -472,388 +876,616 @@ void USpriterSkeletonComponent::SetToSetupPose()
 	}
 }
 
-void USpriterSkeletonComponent::UpdateBones()
+void USpriterSkeletonComponent::UpdatePose()
 {
 	if (IsInitialized(true))
 	{
-		const TArray<FSpriterMainlineKey*>& MainKeys = GetMainlineKeys();
-		float Alpha = 0.f;
-		float C1 = 0.f;
-		float C2 = 0.f;
-
-		// Finding Alpha for Mainline Keys
-		if (MainKeys.Num() >= 2)
+		if (ActiveBlendSpace && AnimationState == ESpriterAnimationState::PLAYING && ActiveAnimation)
 		{
-			if (AnimationState == ESpriterAnimationState::BLENDING)
-			{
-				C1 = CurrentBlendTimeMS;
-				C2 = BlendDurationMS;
-			}
-			else if (AnimationState == ESpriterAnimationState::PLAYING)
-			{
-				if (MainKeys[1]->TimeInMS == 0 && ActiveAnimation)
-				{
-					C1 = (CurrentTimeMS - MainKeys[0]->TimeInMS);
-					C2 = (ActiveAnimation->LengthInMS - MainKeys[0]->TimeInMS);
-				}
-				else
-				{
-					C1 = (CurrentTimeMS - MainKeys[0]->TimeInMS);
-					C2 = (MainKeys[1]->TimeInMS - MainKeys[0]->TimeInMS);
-				}
-			}
+			EvaluateBlendSpacePose();
+		}
+		// Blends depend on two Animations and their own Blend time, so only Playing Poses are shared
+		else if (bUsePoseCache && AnimationState == ESpriterAnimationState::PLAYING && ActiveAnimation)
+		{
+			// Skeletons sampling the Baked Animation and ones interpolating the Keys evaluate different Poses at the same time
+			const float Quantum = FMath::Max(PoseCacheQuantumMS, 1.f);
+			const bool bBaked = bUseBakedAnimations && Skeleton->GetBakedAnimation(ActiveAnimation);
+			const FSpriterPoseCacheKey Key(Skeleton, ActiveAnimation, FMath::FloorToFloat(CurrentTimeMS / Quantum) * Quantum, bBaked);
 
-			if (MainKeys[0]->TimeInMS == MainKeys[1]->TimeInMS && AnimationState == ESpriterAnimationState::PLAYING)
+			FSpriterPoseCache& Cache = FSpriterPoseCache::Get();
+			if (!Cache.Find(Key, Pose, TimelineKeyPairs, MainlineKeyPair))
 			{
-				Alpha = 0;
-			}
-			else if (C2 == 0)
-			{
-				Alpha = 0;
-			}
-			else
-			{
-				Alpha = C1 / C2;
+				// Evaluate at the quantized time, so every Skeleton sharing the entry sees the same Pose
+				const float PlayingTimeMS = CurrentTimeMS;
+				CurrentTimeMS = Key.TimeMS;
+				EvaluateLocalPose();
+				CurrentTimeMS = PlayingTimeMS;
+
+				Cache.Add(Key, Pose, TimelineKeyPairs, MainlineKeyPair);
 			}
 		}
+		else
+		{
+			EvaluateLocalPose();
+		}
+
+		// Layers are per Skeleton, so they go on top of a shared Pose
+		BlendLayers();
 
-		for (FSpriterBoneInstance& Bone : Bones)
+		if (bBlendingFromSnapshot)
 		{
-			// Check if Bone is Referenced in Mainline
-			if (MainKeys.Num() >= 2)
-			{
-				FSpriterRef* Ref;
-				if (AnimationState == ESpriterAnimationState::BLENDING)
-				{
-					if (Alpha == 1)
-					{
-						Ref = GetBoneRef(*NextAnimation, *MainKeys[1], Bone.Name);
-					}
-					else
-					{
-						Ref = GetBoneRef(*ActiveAnimation, *MainKeys[0], Bone.Name);
-					}
-				}
-				else
-				{
-					if (Alpha == 1)
-					{
-						Ref = GetBoneRef(*ActiveAnimation, *MainKeys[1], Bone.Name);
-					}
-					else
-					{
-						Ref = GetBoneRef(*ActiveAnimation, *MainKeys[0], Bone.Name);
-					}
-				}
+			BlendFromSnapshot();
+		}
 
-				if (Ref)
-				{
-					Bone.IsActive = true;
-					
-					if (Bone.IsActive)
-					{
-						/*FSpriterTimeline* ParentTimeline = nullptr;
-						if (AnimationState == ESpriterAnimationState::BLENDING)
-						{
-							if (Alpha == 1)
-							{
-								ParentTimeline = GetTimeline(*NextAnimation, Ref->ParentTimelineIndex);
-							}
-						}
-						else
-						{
-							ParentTimeline = GetTimeline(*ActiveAnimation, Ref->ParentTimelineIndex);
-						}
-
-						if (ParentTimeline)
-						{
-							Sprite.ParentBoneName = ParentTimeline->Name;
-						}*/
+		if (bExtractRootMotion)
+		{
+			RemoveRootMotion();
+		}
+	}
+}
 
-					}
-				}
-				else
-				{
-					Bone.IsActive = false;
-				}
-			}
+void USpriterSkeletonComponent::RemoveRootMotion()
+{
+	const FSpriterRootTrack* RootTrack = Skeleton->GetRootTrack(ActiveAnimation);
+	if (RootTrack && Pose.IsSampled(RootBoneSlot))
+	{
+		const FVector& Start = RootTrack->Samples[0];
+		Pose.X[RootBoneSlot] = Start.X;
+		Pose.Y[RootBoneSlot] = Start.Y;
+		Pose.Angle[RootBoneSlot] = Start.Z;
+	}
+}
 
-			// Update Bone if Referenced in Mainline
-			if (Bone.IsActive)
+void USpriterSkeletonComponent::BlendFromSnapshot()
+{
+	const float BlendAlpha = (BlendDurationMS > 0.f) ? FMath::Clamp(CurrentBlendTimeMS / BlendDurationMS, 0.f, 1.f) : 1.f;
+
+	// Ease out of the Snapshot, so its motion doesn't stop dead when the Blend starts
+	const float SnapshotWeight = 1.f - (BlendAlpha * BlendAlpha * (3.f - (2.f * BlendAlpha)));
+	FSpriterPoseEvaluator::Blend(BlendSnapshot, SnapshotWeight, Pose);
+}
+
+int32 USpriterSkeletonComponent::AddLayer(const FString& AnimationName, float Weight, ESpriterLayerBlendMode BlendMode, const TArray<FString>& Mask)
+{
+	FSpriterAnimationLayer Layer = FSpriterAnimationLayer();
+	Layer.AnimationName = AnimationName;
+	Layer.Weight = Weight;
+	Layer.BlendMode = BlendMode;
+	Layer.Mask = Mask;
+
+	const int32 LayerIndex = Layers.Add(Layer);
+	if (IsInitialized(false))
+	{
+		PrepareLayer(Layers[LayerIndex]);
+	}
+
+	return LayerIndex;
+}
+
+void USpriterSkeletonComponent::SetLayerWeight(int32 LayerIndex, float Weight)
+{
+	if (Layers.IsValidIndex(LayerIndex))
+	{
+		Layers[LayerIndex].Weight = Weight;
+	}
+}
+
+void USpriterSkeletonComponent::SetLayerAnimation(int32 LayerIndex, const FString& AnimationName, float TimeMS)
+{
+	if (Layers.IsValidIndex(LayerIndex))
+	{
+		FSpriterAnimationLayer& Layer = Layers[LayerIndex];
+		Layer.AnimationName = AnimationName;
+		Layer.TimeMS = TimeMS;
+
+		if (IsInitialized(false))
+		{
+			PrepareLayer(Layer);
+		}
+	}
+}
+
+void USpriterSkeletonComponent::RemoveLayer(int32 LayerIndex)
+{
+	if (Layers.IsValidIndex(LayerIndex))
+	{
+		Layers.RemoveAt(LayerIndex);
+	}
+}
+
+void USpriterSkeletonComponent::ClearLayers()
+{
+	Layers.Empty();
+}
+
+void USpriterSkeletonComponent::PlayBlendSpace(USpriterBlendSpace* BlendSpace, FVector2D Input, float BlendLengthMS)
+{
+	if (!BlendSpace || !IsInitialized(true))
+	{
+		return;
+	}
+
+	BlendSpacePlayers.SetNum(BlendSpace->Samples.Num());
+	for (int32 SampleIndex = 0; SampleIndex < BlendSpacePlayers.Num(); ++SampleIndex)
+	{
+		FSpriterAnimationLayer& Player = BlendSpacePlayers[SampleIndex];
+		Player.AnimationName = BlendSpace->Samples[SampleIndex].AnimationName;
+		PrepareLayer(Player);
+	}
+
+	ActiveBlendSpace = BlendSpace;
+	BlendSpaceInput = Input;
+	UpdateBlendSpaceWeights();
+	if (BlendSpaceWeights.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("USpriterSkeletonComponent_PlayBlendSpace() : No Animation of the Blend Space was found in the Active Entity"));
+		ActiveBlendSpace = nullptr;
+		return;
+	}
+
+	// The heaviest Sample starts like any other Animation, the rest are blended over it from then on
+	PlayAnimation(BlendSpacePlayers[BlendSpaceWeights[0].SampleIndex].AnimationName, BlendLengthMS);
+	ActiveBlendSpace = BlendSpace;
+}
+
+void USpriterSkeletonComponent::SetBlendSpaceInput(FVector2D Input)
+{
+	BlendSpaceInput = Input;
+	UpdateBlendSpaceWeights();
+	if (BlendSpaceWeights.Num() == 0)
+	{
+		return;
+	}
+
+	// Only while the Blend Space drives playback, a Blend into it keeps its own Animations
+	FSpriterAnimation* Heaviest = BlendSpacePlayers[BlendSpaceWeights[0].SampleIndex].Animation;
+	if (AnimationState == ESpriterAnimationState::PLAYING && ActiveAnimation && Heaviest != ActiveAnimation)
+	{
+		const float NormalizedTime = (ActiveAnimation->LengthInMS > 0) ? (CurrentTimeMS / ActiveAnimation->LengthInMS) : 0.f;
+		ActiveAnimation = Heaviest;
+		CurrentTimeMS = NormalizedTime * ActiveAnimation->LengthInMS;
+
+		// Events carry on from the same point of the cycle instead of replaying the new Animation's earlier Keys
+		EventAnimation = ActiveAnimation;
+		EventTimeMS = CurrentTimeMS;
+	}
+}
+
+void USpriterSkeletonComponent::UpdateBlendSpaceWeights()
+{
+	if (!ActiveBlendSpace || BlendSpacePlayers.Num() != ActiveBlendSpace->Samples.Num())
+	{
+		BlendSpaceWeights.Reset();
+		return;
+	}
+
+	ActiveBlendSpace->GetSampleWeights(BlendSpaceInput, BlendSpaceWeights);
+
+	// Samples missing from the Entity are left out, the rest share their Weight
+	float TotalWeight = 0.f;
+	for (int32 WeightIndex = BlendSpaceWeights.Num() - 1; WeightIndex >= 0; --WeightIndex)
+	{
+		if (BlendSpacePlayers[BlendSpaceWeights[WeightIndex].SampleIndex].Animation)
+		{
+			TotalWeight += BlendSpaceWeights[WeightIndex].Weight;
+		}
+		else
+		{
+			BlendSpaceWeights.RemoveAt(WeightIndex);
+		}
+	}
+
+	if (BlendSpaceWeights.Num() == 0 || TotalWeight <= 0.f)
+	{
+		BlendSpaceWeights.Reset();
+		return;
+	}
+
+	for (FSpriterBlendSampleWeight& SampleWeight : BlendSpaceWeights)
+	{
+		SampleWeight.Weight /= TotalWeight;
+	}
+}
+
+float USpriterSkeletonComponent::GetBlendSpaceTimeScale() const
+{
+	if (!ActiveBlendSpace || !ActiveAnimation || BlendSpaceWeights.Num() == 0)
+	{
+		return 1.f;
+	}
+
+	// The cycle length is the weighted length of every Sample
+	float BlendedLengthMS = 0.f;
+	for (const FSpriterBlendSampleWeight& SampleWeight : BlendSpaceWeights)
+	{
+		const FSpriterAnimation* Animation = BlendSpacePlayers[SampleWeight.SampleIndex].Animation;
+		BlendedLengthMS += SampleWeight.Weight * Animation->LengthInMS;
+	}
+
+	return (BlendedLengthMS > 0.f) ? (ActiveAnimation->LengthInMS / BlendedLengthMS) : 1.f;
+}
+
+void USpriterSkeletonComponent::EvaluateBlendSpacePose()
+{
+	EvaluateLocalPose();
+
+	// The Active Animation's share is already in the Pose
+	float BlendedWeight = 0.f;
+	for (const FSpriterBlendSampleWeight& SampleWeight : BlendSpaceWeights)
+	{
+		if (BlendSpacePlayers[SampleWeight.SampleIndex].Animation == ActiveAnimation)
+		{
+			BlendedWeight += SampleWeight.Weight;
+		}
+	}
+
+	// Discrete data (Files, Pivots, Refs) stays with the Active Animation, the other Samples only move the slots
+	const float NormalizedTime = (ActiveAnimation->LengthInMS > 0) ? (CurrentTimeMS / ActiveAnimation->LengthInMS) : 0.f;
+	for (const FSpriterBlendSampleWeight& SampleWeight : BlendSpaceWeights)
+	{
+		FSpriterAnimationLayer& Player = BlendSpacePlayers[SampleWeight.SampleIndex];
+		if (Player.Animation == ActiveAnimation || SampleWeight.Weight <= 0.f)
+		{
+			continue;
+		}
+
+		BlendedWeight += SampleWeight.Weight;
+
+		// Blending in one Sample at a time by its share of the Weight so far gives the weighted average of all of them
+		EvaluateLayerPose(Player, NormalizedTime * Player.Animation->LengthInMS, Player.Pose);
+		FSpriterPoseEvaluator::Blend(Player.Pose, SampleWeight.Weight / BlendedWeight, Pose);
+	}
+}
+
+FVector USpriterSkeletonComponent::GetRootMotionWorldTranslation() const
+{
+	return GetComponentToWorld().TransformVector((RootMotionTranslation.X * PaperAxisX) + (RootMotionTranslation.Y * PaperAxisY));
+}
+
+void USpriterSkeletonComponent::GetPoseCacheStats(int32& Hits, int32& Misses)
+{
+	Hits = FSpriterPoseCache::Get().GetNumHits();
+	Misses = FSpriterPoseCache::Get().GetNumMisses();
+}
+
+void USpriterSkeletonComponent::ResetPoseCacheStats()
+{
+	FSpriterPoseCache::Get().ResetStats();
+}
+
+void USpriterSkeletonComponent::EvaluateLocalPose()
+{
+	// Baked Animations are sampled in constant time, Blends always go through the Keyframes
+	const FSpriterBakedAnimation* Baked = (bUseBakedAnimations && AnimationState == ESpriterAnimationState::PLAYING) ? Skeleton->GetBakedAnimation(ActiveAnimation) : nullptr;
+	if (Baked)
+	{
+		SampleBakedPose(*Baked);
+		return;
+	}
+
+	GetMainlineKeys(MainlineKeyPair);
+
+	// A playing Animation finds its Timeline Keys at the time its Mainline Key's Curve eased
+	EasedTimeMS = CurrentTimeMS;
+	if (AnimationState == ESpriterAnimationState::PLAYING && ActiveAnimation)
+	{
+		EasedTimeMS = FSpriterCurve::EaseMainlineTime(*ActiveAnimation, GetPlaybackCursor().MainlineKey, CurrentTimeMS);
+	}
+
+	for (int32 Slot = 0; Slot < TimelineKeyPairs.Num(); ++Slot)
+	{
+		GetTimelineKeys(Slot, TimelineKeyPairs[Slot]);
+	}
+
+	FSpriterPoseEvaluator::Evaluate(TimelineKeyPairs, Pose);
+}
+
+void USpriterSkeletonComponent::PrepareLayer(FSpriterAnimationLayer& Layer)
+{
+	const int32 NumObjects = Binding->GetNumObjects();
+
+	Layer.Animation = Layer.AnimationName.IsEmpty() ? nullptr : GetAnimation(Layer.AnimationName);
+	Layer.Cursor.Reset(Layer.Animation);
+	Layer.KeyPairs.SetNum(NumObjects);
+	Layer.Pose.SetNum(NumObjects);
+	Layer.ReferencePose.SetNum(NumObjects);
+	Layer.bReferencePoseValid = false;
+
+	// An empty Mask affects everything
+	Layer.SlotWeights.Init(Layer.Mask.Num() == 0 ? 1.f : 0.f, NumObjects);
+	if (Layer.Mask.Num() == 0)
+	{
+		return;
+	}
+
+	// Bones are stored Parent before Child, so a Bone's Parent has already been decided
+	TArray<bool> MaskedBones;
+	MaskedBones.Init(false, Bones.Num());
+	for (int32 BoneIndex = 0; BoneIndex < Bones.Num(); ++BoneIndex)
+	{
+		const int32 ParentIndex = Bones[BoneIndex].ParentBoneIndex;
+		MaskedBones[BoneIndex] = Layer.Mask.Contains(Bones[BoneIndex].Name) || (ParentIndex != INDEX_NONE && MaskedBones[ParentIndex]);
+		Layer.SlotWeights[Binding->GetBoneSlot(BoneIndex)] = MaskedBones[BoneIndex] ? 1.f : 0.f;
+	}
+
+	for (int32 SpriteIndex = 0; SpriteIndex < Sprites.Num(); ++SpriteIndex)
+	{
+		Layer.SlotWeights[Binding->GetSpriteSlot(SpriteIndex)] = Layer.Mask.Contains(Sprites[SpriteIndex].Name) ? 1.f : 0.f;
+	}
+
+	for (int32 BoxIndex = 0; BoxIndex < Boxs.Num(); ++BoxIndex)
+	{
+		Layer.SlotWeights[Binding->GetBoxSlot(BoxIndex)] = Layer.Mask.Contains(Boxs[BoxIndex].Name) ? 1.f : 0.f;
+	}
+
+	for (int32 PointIndex = 0; PointIndex < Points.Num(); ++PointIndex)
+	{
+		Layer.SlotWeights[Binding->GetPointSlot(PointIndex)] = Layer.Mask.Contains(Points[PointIndex].Name) ? 1.f : 0.f;
+	}
+}
+
+void USpriterSkeletonComponent::EvaluateLayerPose(FSpriterAnimationLayer& Layer, float TimeMS, FSpriterPose& OutPose)
+{
+	FSpriterAnimation& Animation = *Layer.Animation;
+	const FSpriterAnimationBinding* AnimationBinding = GetAnimationBinding(&Animation);
+
+	// Same two paths as the Active Animation, Baked Tracks when there are some and the Keys otherwise
+	const FSpriterBakedAnimation* Baked = bUseBakedAnimations ? Skeleton->GetBakedAnimation(&Animation) : nullptr;
+	if (Baked && AnimationBinding)
+	{
+		int32 SampleIndex = 0;
+		float SampleAlpha = 0.f;
+		Baked->GetSample(TimeMS, SampleIndex, SampleAlpha);
+
+		for (int32 Slot = 0; Slot < Layer.KeyPairs.Num(); ++Slot)
+		{
+			FSpriterTimelineKeyPair& Keys = Layer.KeyPairs[Slot];
+			Keys.Reset();
+			OutPose.Sampled[Slot] = false;
+
+			const int32 TimelineIndex = AnimationBinding->ObjectTimelines[Slot];
+
+			FSpriterTransform2D Transform;
+			FLinearColor Color;
+			int32 Key = INDEX_NONE;
+			if (Baked->SampleTimeline(TimelineIndex, SampleIndex, SampleAlpha, Transform, Color, Key))
 			{
-				const TArray<FSpriterFatTimelineKey*>& Keys = GetTimelineKeys(Bone.Name);
-				if (Keys.Num() >= 2)
-				{
-					if (AnimationState == ESpriterAnimationState::BLENDING)
-					{
-						C1 = CurrentBlendTimeMS;
-						C2 = BlendDurationMS;
-					}
-					else if (AnimationState == ESpriterAnimationState::PLAYING)
-					{
-						if (Keys[1]->TimeInMS == 0 && ActiveAnimation)
-						{
-							C1 = (CurrentTimeMS - Keys[0]->TimeInMS);
-							C2 = (ActiveAnimation->LengthInMS - Keys[0]->TimeInMS);
-						}
-						else
-						{
-							C1 = (CurrentTimeMS - Keys[0]->TimeInMS);
-							C2 = (Keys[1]->TimeInMS - Keys[0]->TimeInMS);
-						}
-					}
+				Keys.First = &Animation.Timelines[TimelineIndex].Keys[Key];
+				Keys.Second = Keys.First;
+				OutPose.SetSlot(Slot, Transform, Color);
+			}
+		}
 
-					if (Keys[0]->TimeInMS == Keys[1]->TimeInMS && AnimationState == ESpriterAnimationState::PLAYING)
-					{
-						Alpha = 0;
-					}
-					else if (C2 == 0)
-					{
-						Alpha = 0;
-					}
-					else
-					{
-						Alpha = C1 / C2;
-					}
+		return;
+	}
 
-					FTransform RelativeTransform = FTransform();
-					FTransform FirstTransform = Keys[0]->Info.ConvertToTransform();
-					FTransform SecondTransform = Keys[1]->Info.ConvertToTransform();
-					float SpinCorrection = 0;
-					if (Keys[0]->Spin > 0 && (FirstTransform.Rotator().Pitch > SecondTransform.Rotator().Pitch))
-					{
-						SpinCorrection = 360;
-					}
-					else if (Keys[0]->Spin < 0 && (SecondTransform.Rotator().Pitch > FirstTransform.Rotator().Pitch))
-					{
-						SpinCorrection = -360;
-					}
+	const int32 MainlineKey = FSpriterPlaybackCursor::FindKey(Animation.MainlineKeys, TimeMS, Layer.Cursor.MainlineKey);
+	const float EasedTimeMS = FSpriterCurve::EaseMainlineTime(Animation, MainlineKey, TimeMS);
 
-					RelativeTransform.SetLocation(FMath::Lerp(FirstTransform.GetLocation(), SecondTransform.GetLocation(), Alpha));
-					RelativeTransform.SetRotation(FQuat::Slerp_NotNormalized(FirstTransform.GetRotation(), (SecondTransform.Rotator() + FRotator(SpinCorrection, 0, 0)).Quaternion(), Alpha));
-					RelativeTransform.SetScale3D(FMath::Lerp(FirstTransform.GetScale3D(), SecondTransform.GetScale3D(), Alpha));
+	for (int32 Slot = 0; Slot < Layer.KeyPairs.Num(); ++Slot)
+	{
+		FSpriterTimelineKeyPair& Keys = Layer.KeyPairs[Slot];
+		Keys.Reset();
 
-					Bone.RelativeTransform = RelativeTransform;
-					Bone.RelativeTransform.SetLocation(Bone.RelativeTransform.GetLocation() / Skeleton->PixelsPerUnrealUnit);
-					if (!Bone.ParentBoneName.IsEmpty())
-					{
-						FSpriterBoneInstance* Parent = GetBone(Bone.ParentBoneName);
-						if (Parent)
-						{
-							FTransform::Multiply(&Bone.WorldTransform, &Bone.RelativeTransform, &Parent->WorldTransform);
-						}
-					}
-					else
-					{
-						Bone.WorldTransform = RelativeTransform;
-					}
-				}
+		const int32 TimelineIndex = AnimationBinding ? AnimationBinding->ObjectTimelines[Slot] : INDEX_NONE;
+		FSpriterTimeline* Timeline = GetTimeline(Animation, TimelineIndex);
+		if (Timeline)
+		{
+			const int32 Key = FSpriterPlaybackCursor::FindKey(Timeline->Keys, EasedTimeMS, Layer.Cursor.TimelineKeys[TimelineIndex]);
+			if (Key != INDEX_NONE)
+			{
+				Keys.First = &Timeline->Keys[Key];
+				Keys.Second = &Timeline->Keys[(Key + 1) % Timeline->Keys.Num()];
+
+				const float Alpha = FSpriterPlaybackCursor::GetPlayingAlpha(EasedTimeMS, Keys.First->TimeInMS, Keys.Second->TimeInMS, Animation.LengthInMS);
+				Keys.Alpha = FSpriterCurve::EaseTimelineAlpha(*Keys.First, Alpha);
 			}
 		}
 	}
+
+	FSpriterPoseEvaluator::Evaluate(Layer.KeyPairs, OutPose);
 }
 
-void USpriterSkeletonComponent::UpdateSprites()
+void USpriterSkeletonComponent::BlendLayers()
 {
-	if (IsInitialized(true))
+	for (FSpriterAnimationLayer& Layer : Layers)
 	{
-		const TArray<FSpriterMainlineKey*>& MainKeys = GetMainlineKeys();
-		float Alpha = 0.f;
-		float C1 = 0.f;
-		float C2 = 0.f;
+		if (!Layer.Animation || Layer.Weight <= 0.f || Layer.SlotWeights.Num() != Pose.Num())
+		{
+			continue;
+		}
+
+		if (Layer.BlendMode == ESpriterLayerBlendMode::ADDITIVE && !Layer.bReferencePoseValid)
+		{
+			EvaluateLayerPose(Layer, 0.f, Layer.ReferencePose);
+			Layer.bReferencePoseValid = true;
+		}
+
+		EvaluateLayerPose(Layer, Layer.TimeMS, Layer.Pose);
 
-		// Finding Alpha for Mainline Keys
-		if (MainKeys.Num() >= 2)
+		const FSpriterPose& LayerPose = Layer.Pose;
+		const FSpriterPose& ReferencePose = Layer.ReferencePose;
+		for (int32 Slot = 0; Slot < Pose.Num(); ++Slot)
 		{
-			if (AnimationState == ESpriterAnimationState::BLENDING)
+			// Which Objects exist and what they're attached to still comes from the Active Animation
+			const float Weight = Layer.Weight * Layer.SlotWeights[Slot];
+			if (Weight <= 0.f || !Pose.Sampled[Slot] || !LayerPose.Sampled[Slot])
 			{
-				C1 = CurrentBlendTimeMS;
-				C2 = BlendDurationMS;
+				continue;
 			}
-			else if (AnimationState == ESpriterAnimationState::PLAYING)
+
+			if (Layer.BlendMode == ESpriterLayerBlendMode::OVERRIDE)
 			{
-				if (MainKeys[1]->TimeInMS == 0 && ActiveAnimation)
-				{
-					C1 = (CurrentTimeMS - MainKeys[0]->TimeInMS);
-					C2 = (ActiveAnimation->LengthInMS - MainKeys[0]->TimeInMS);
-				}
-				else
+				Pose.X[Slot] = FMath::Lerp(Pose.X[Slot], LayerPose.X[Slot], Weight);
+				Pose.Y[Slot] = FMath::Lerp(Pose.Y[Slot], LayerPose.Y[Slot], Weight);
+				Pose.Angle[Slot] += FRotator::NormalizeAxis(LayerPose.Angle[Slot] - Pose.Angle[Slot]) * Weight;
+				Pose.ScaleX[Slot] = FMath::Lerp(Pose.ScaleX[Slot], LayerPose.ScaleX[Slot], Weight);
+				Pose.ScaleY[Slot] = FMath::Lerp(Pose.ScaleY[Slot], LayerPose.ScaleY[Slot], Weight);
+				Pose.Alpha[Slot] = FMath::Lerp(Pose.Alpha[Slot], LayerPose.Alpha[Slot], Weight);
+				Pose.Color[Slot] = FMath::Lerp(Pose.Color[Slot], LayerPose.Color[Slot], Weight);
+
+				// Past halfway the Layer decides which File a Sprite shows
+				if (Weight >= 0.5f)
 				{
-					C1 = (CurrentTimeMS - MainKeys[0]->TimeInMS);
-					C2 = (MainKeys[1]->TimeInMS - MainKeys[0]->TimeInMS);
+					TimelineKeyPairs[Slot] = Layer.KeyPairs[Slot];
 				}
 			}
+			else if (ReferencePose.Sampled[Slot])
+			{
+				Pose.X[Slot] += (LayerPose.X[Slot] - ReferencePose.X[Slot]) * Weight;
+				Pose.Y[Slot] += (LayerPose.Y[Slot] - ReferencePose.Y[Slot]) * Weight;
+				Pose.Angle[Slot] += FRotator::NormalizeAxis(LayerPose.Angle[Slot] - ReferencePose.Angle[Slot]) * Weight;
+				Pose.ScaleX[Slot] *= FMath::Lerp(1.f, (ReferencePose.ScaleX[Slot] != 0.f) ? (LayerPose.ScaleX[Slot] / ReferencePose.ScaleX[Slot]) : 1.f, Weight);
+				Pose.ScaleY[Slot] *= FMath::Lerp(1.f, (ReferencePose.ScaleY[Slot] != 0.f) ? (LayerPose.ScaleY[Slot] / ReferencePose.ScaleY[Slot]) : 1.f, Weight);
+				Pose.Alpha[Slot] = FMath::Clamp(Pose.Alpha[Slot] + ((LayerPose.Alpha[Slot] - ReferencePose.Alpha[Slot]) * Weight), 0.f, 1.f);
+			}
+		}
+	}
+}
+
+void USpriterSkeletonComponent::AdvanceLayers(float DeltaTime)
+{
+	for (FSpriterAnimationLayer& Layer : Layers)
+	{
+		if (!Layer.Animation || Layer.Animation->LengthInMS <= 0)
+		{
+			continue;
+		}
 
-			if (MainKeys[0]->TimeInMS == MainKeys[1]->TimeInMS && AnimationState == ESpriterAnimationState::PLAYING)
+		const float LengthInMS = Layer.Animation->LengthInMS;
+		Layer.TimeMS += DeltaTime * 1000.f * Layer.PlayRate;
+		if (Layer.Animation->bIsLooping)
+		{
+			Layer.TimeMS = FMath::Fmod(Layer.TimeMS, LengthInMS);
+			if (Layer.TimeMS < 0.f)
 			{
-				Alpha = 0;
+				Layer.TimeMS += LengthInMS;
 			}
-			else if (C2 == 0)
+		}
+		else
+		{
+			Layer.TimeMS = FMath::Clamp(Layer.TimeMS, 0.f, LengthInMS);
+		}
+	}
+}
+
+void USpriterSkeletonComponent::SampleBakedPose(const FSpriterBakedAnimation& Baked)
+{
+	int32 SampleIndex = 0;
+	float SampleAlpha = 0.f;
+	Baked.GetSample(CurrentTimeMS, SampleIndex, SampleAlpha);
+
+	// Discrete data (Refs, Files, Pivots) comes from the Keys in effect at the Sample, so both Keys of a Pair are the same
+	MainlineKeyPair.Reset();
+	const int32 MainlineKey = Baked.GetMainlineKey(SampleIndex);
+	if (ActiveAnimation->MainlineKeys.IsValidIndex(MainlineKey))
+	{
+		MainlineKeyPair.First = &ActiveAnimation->MainlineKeys[MainlineKey];
+		MainlineKeyPair.Second = MainlineKeyPair.First;
+	}
+
+	const FSpriterAnimationBinding* AnimationBinding = GetAnimationBinding(ActiveAnimation);
+	for (int32 Slot = 0; Slot < TimelineKeyPairs.Num(); ++Slot)
+	{
+		FSpriterTimelineKeyPair& Keys = TimelineKeyPairs[Slot];
+		Keys.Reset();
+		Pose.Sampled[Slot] = false;
+
+		const int32 TimelineIndex = AnimationBinding ? AnimationBinding->ObjectTimelines[Slot] : INDEX_NONE;
+
+		FSpriterTransform2D Transform;
+		FLinearColor Color;
+		int32 Key = INDEX_NONE;
+		if (Baked.SampleTimeline(TimelineIndex, SampleIndex, SampleAlpha, Transform, Color, Key))
+		{
+			Keys.First = &ActiveAnimation->Timelines[TimelineIndex].Keys[Key];
+			Keys.Second = Keys.First;
+			Pose.SetSlot(Slot, Transform, Color);
+		}
+	}
+}
+
+void USpriterSkeletonComponent::UpdateBones()
+{
+	if (IsInitialized(true))
+	{
+		// Bones are sorted Parent before Child by InitSkeleton, so every Parent's World Transform is already up to date
+		for (int32 BoneIndex = 0; BoneIndex < Bones.Num(); ++BoneIndex)
+		{
+			FSpriterBoneInstance& Bone = Bones[BoneIndex];
+			const int32 Slot = Binding->GetBoneSlot(BoneIndex);
+
+			// Check if Bone is Referenced in Mainline
+			if (MainlineKeyPair.IsValid())
 			{
-				Alpha = 0;
+				FSpriterAnimation* RefAnimation = nullptr;
+				FSpriterMainlineKey* RefKey = GetRefKey(MainlineKeyPair, RefAnimation);
+
+				Bone.IsActive = (RefAnimation && GetBoneRef(*RefAnimation, *RefKey, BoneIndex));
 			}
-			else
+
+			// Update Bone if Referenced in Mainline
+			if (Bone.IsActive && Pose.IsSampled(Slot))
 			{
-				Alpha = C1 / C2;
+				const FSpriterTransform2D Relative = Pose.GetTransform(Slot);
+				Bone.WorldTransform2D = GetWorldTransform2D(Bone.ParentBoneIndex, Relative);
+
+				Bone.RelativeTransform = Relative.ToTransform();
+				Bone.WorldTransform = Bone.WorldTransform2D.ToTransform();
 			}
 		}
+	}
+}
 
-		for (FSpriterSpriteInstance& Sprite : Sprites)
+void USpriterSkeletonComponent::UpdateSprites()
+{
+	EvaluateSprites();
+	ApplySprites();
+}
+
+void USpriterSkeletonComponent::EvaluateSprites()
+{
+	if (IsInitialized(true))
+	{
+		for (int32 SpriteIndex = 0; SpriteIndex < Sprites.Num(); ++SpriteIndex)
 		{
+			FSpriterSpriteInstance& Sprite = Sprites[SpriteIndex];
+			const int32 Slot = Binding->GetSpriteSlot(SpriteIndex);
+
 			// Check if Sprite is Referenced in Mainline
-			if (MainKeys.Num() >= 2)
+			if (MainlineKeyPair.IsValid())
 			{
-				FSpriterObjectRef* Ref;
-				if (AnimationState == ESpriterAnimationState::BLENDING)
-				{
-					if (Alpha == 1)
-					{
-						Ref = GetObjectRef(*NextAnimation, *MainKeys[1], Sprite.Name);
-					}
-					else
-					{
-						Ref = GetObjectRef(*ActiveAnimation, *MainKeys[0], Sprite.Name);
-					}
-				}
-				else
-				{
-					if (Alpha == 1)
-					{
-						Ref = GetObjectRef(*ActiveAnimation, *MainKeys[1], Sprite.Name);
-					}
-					else
-					{
-						Ref = GetObjectRef(*ActiveAnimation, *MainKeys[0], Sprite.Name);
-					}
-				}
+				FSpriterAnimation* RefAnimation = nullptr;
+				FSpriterMainlineKey* RefKey = GetRefKey(MainlineKeyPair, RefAnimation);
+				FSpriterObjectRef* Ref = RefAnimation ? GetObjectRef(*RefAnimation, *RefKey, Slot) : nullptr;
 
 				if (Ref)
 				{
 					Sprite.IsActive = true;
-					Sprite.SpriteComponent->Activate(true);
 
-					if (Sprite.IsActive)
-					{
-						FSpriterTimeline* ParentTimeline = nullptr;
-						if (AnimationState == ESpriterAnimationState::BLENDING)
-						{
-							if (Alpha == 1)
-							{
-								ParentTimeline = GetTimeline(*NextAnimation, Ref->ParentTimelineIndex);
-							}
-						}
-						else
-						{
-							ParentTimeline = GetTimeline(*ActiveAnimation, Ref->ParentTimelineIndex);
-						}
-
-						if (ParentTimeline)
-						{
-							Sprite.ParentBoneName = ParentTimeline->Name;
-						}
-
-						Sprite.ZIndex = Ref->ZIndex;
-					}
+					SetInstanceParentBone(Sprite, GetRefParentBone(*RefAnimation, *Ref), Bones);
+					Sprite.ZIndex = Ref->ZIndex;
 				}
 				else
 				{
 					Sprite.IsActive = false;
-					Sprite.SpriteComponent->Activate(false);
 				}
 			}
 
 			// Update Sprite if Referenced in Mainline
 			if (Sprite.IsActive)
 			{
-				const TArray<FSpriterFatTimelineKey*>& Keys = GetTimelineKeys(Sprite.Name);
-				if (Keys.Num() >= 2)
+				if (Pose.IsSampled(Slot))
 				{
-					// Finding Alpha for Timeline Keys
-					if (AnimationState == ESpriterAnimationState::BLENDING)
-					{
-						C1 = CurrentBlendTimeMS;
-						C2 = BlendDurationMS;
-					}
-					else if (AnimationState == ESpriterAnimationState::PLAYING)
-					{
-						if (Keys[1]->TimeInMS == 0 && ActiveAnimation)
-						{
-							C1 = (CurrentTimeMS - Keys[0]->TimeInMS);
-							C2 = (ActiveAnimation->LengthInMS - Keys[0]->TimeInMS);
-						}
-						else
-						{
-							C1 = (CurrentTimeMS - Keys[0]->TimeInMS);
-							C2 = (Keys[1]->TimeInMS - Keys[0]->TimeInMS);
-						}
-					}
-
-					if (Keys[0]->TimeInMS == Keys[1]->TimeInMS && AnimationState == ESpriterAnimationState::PLAYING)
-					{
-						Alpha = 0;
-					}
-					else if (C2 == 0)
-					{
-						Alpha = 0;
-					}
-					else
-					{
-						Alpha = C1 / C2;
-					}
-
-					// Updating Sprite from Timeline Keys
-					FTransform RelativeTransform = FTransform();
-					FTransform FirstTransform = Keys[0]->Info.ConvertToTransform();
-					FTransform SecondTransform = Keys[1]->Info.ConvertToTransform();
-					float SpinCorrection = 0;
-					if (Keys[0]->Spin > 0 && (FirstTransform.Rotator().Pitch > SecondTransform.Rotator().Pitch))
-					{
-						SpinCorrection = 360;
-					}
-					else if (Keys[0]->Spin < 0 && (SecondTransform.Rotator().Pitch > FirstTransform.Rotator().Pitch))
-					{
-						SpinCorrection = -360;
-					}
-
-					RelativeTransform.SetLocation(FMath::Lerp(FirstTransform.GetLocation(), SecondTransform.GetLocation(), Alpha));
-					RelativeTransform.SetRotation(FQuat::Slerp_NotNormalized(FirstTransform.GetRotation(), (SecondTransform.Rotator() + FRotator(SpinCorrection, 0, 0)).Quaternion(), Alpha));
-					RelativeTransform.SetScale3D(FMath::Lerp(FirstTransform.GetScale3D(), SecondTransform.GetScale3D(), Alpha));
-
-					Sprite.RelativeTransform = RelativeTransform;
-					Sprite.RelativeTransform.SetLocation(Sprite.RelativeTransform.GetLocation() / Skeleton->PixelsPerUnrealUnit);
-					if (!Sprite.ParentBoneName.IsEmpty())
-					{
-						FSpriterBoneInstance* Parent = GetBone(Sprite.ParentBoneName);
-						if (Parent)
-						{
-							FTransform::Multiply(&Sprite.WorldTransform, &Sprite.RelativeTransform, &Parent->WorldTransform);
-						}
-					}
-					else
-					{
-						Sprite.WorldTransform = RelativeTransform;
-					}
-
-					UPaperSprite* PaperSprite = GetSpriteFromCharacterMap(*GetFile(Keys[0]->FolderIndex, Keys[0]->FileIndex));
-					if (Sprite.SpriteComponent->GetSprite() != PaperSprite)
-					{
-						Sprite.SpriteComponent->SetSprite(PaperSprite);
-					}
-
-					FTransform NewTransform = Sprite.WorldTransform;
-					FLinearColor NewColor = FMath::Lerp<FLinearColor>(Keys[0]->Info.Color, Keys[1]->Info.Color, Alpha);
-					//NewTransform.AddToTranslation(PaperAxisZ * -(Sprite.ZIndex * SPRITER_ZOFFSET));
-					UPaperSprite* SpriteFile = Sprite.SpriteComponent->GetSprite();
-					if (!Keys[0]->bUseDefaultPivot && SpriteFile)
-					{
-						const float PivotInPixelsX = SpriteFile->GetSourceSize().X * Keys[0]->PivotX;
-						const float PivotInPixelsY = SpriteFile->GetSourceSize().Y * (1.0f - Keys[0]->PivotY);
-
-						SpriteFile->SetPivotMode(ESpritePivotMode::Custom, FVector2D(PivotInPixelsX, PivotInPixelsY));
-					}
-					Sprite.SpriteComponent->SetRelativeTransform(NewTransform);
-					Sprite.SpriteComponent->SetTranslucentSortPriority(Sprite.ZIndex);
-					Sprite.SpriteComponent->SetSpriteColor(NewColor);
+					// Updating Sprite from the Pose, File and Pivot come from the Key we're leaving
+					Sprite.RelativeTransform2D = Pose.GetTransform(Slot);
+					Sprite.WorldTransform2D = GetWorldTransform2D(Sprite.ParentBoneIndex, Sprite.RelativeTransform2D);
+					Sprite.EvaluatedColor = Pose.GetColor(Slot);
+					Sprite.EvaluatedKey = TimelineKeyPairs[Slot].First;
+
+					// The Key's Pivot moves this instance's Sprite Component, the shared Sprite asset is never touched
+					const FVector2D& PivotOffset = Sprite.EvaluatedKey->PivotOffset;
+					Sprite.PivotedTransform2D = Sprite.WorldTransform2D.Compose(FSpriterTransform2D(PivotOffset.X, PivotOffset.Y, 0.f, 1.f, 1.f));
 				}
 				else
 				{
@@ -866,376 +1498,268 @@ void USpriterSkeletonComponent::UpdateSprites()
 	}
 }
 
-void USpriterSkeletonComponent::UpdateBoxs()
+void USpriterSkeletonComponent::ApplySprites()
 {
-	if (IsInitialized(true))
+	if (RenderComponent)
+	{
+		ApplySpritesBatched();
+	}
+	else if (IsInitialized(true))
 	{
-		const TArray<FSpriterMainlineKey*>& MainKeys = GetMainlineKeys();
-		float Alpha = 0.f;
-		float C1 = 0.f;
-		float C2 = 0.f;
+		NumPushedUpdates = 0;
+		NumSkippedUpdates = 0;
 
-		// Finding Alpha for Mainline Keys
-		if (MainKeys.Num() >= 2)
+		for (FSpriterSpriteInstance& Sprite : Sprites)
 		{
-			if (AnimationState == ESpriterAnimationState::BLENDING)
+			// Every Set call below can mark render state dirty, so only make it when the value moved past the Tolerance
+			if (!Sprite.bPushed || Sprite.bPushedActive != Sprite.IsActive)
+			{
+				// A Sprite that isnt Active has to render nothing, Activate only resets the Component
+				Sprite.SpriteComponent->SetVisibility(Sprite.IsActive);
+				Sprite.bPushed = true;
+				Sprite.bPushedActive = Sprite.IsActive;
+				++NumPushedUpdates;
+			}
+			else
 			{
-				C1 = CurrentBlendTimeMS;
-				C2 = BlendDurationMS;
+				++NumSkippedUpdates;
 			}
-			else if (AnimationState == ESpriterAnimationState::PLAYING)
+
+			if (Sprite.IsActive && Sprite.EvaluatedKey)
 			{
-				if (MainKeys[1]->TimeInMS == 0 && ActiveAnimation)
+				const FSpriterFatTimelineKey& Key = *Sprite.EvaluatedKey;
+				const bool bFirstPush = (Sprite.PushedKey == nullptr);
+				Sprite.PushedKey = Sprite.EvaluatedKey;
+
+				UPaperSprite* PaperSprite = Key.File ? GetSpriteFromCharacterMap(*Key.File) : nullptr;
+				if (Sprite.SpriteComponent->GetSprite() != PaperSprite)
 				{
-					C1 = (CurrentTimeMS - MainKeys[0]->TimeInMS);
-					C2 = (ActiveAnimation->LengthInMS - MainKeys[0]->TimeInMS);
+					Sprite.SpriteComponent->SetSprite(PaperSprite);
+					++NumPushedUpdates;
 				}
 				else
 				{
-					C1 = (CurrentTimeMS - MainKeys[0]->TimeInMS);
-					C2 = (MainKeys[1]->TimeInMS - MainKeys[0]->TimeInMS);
+					++NumSkippedUpdates;
 				}
-			}
-
-			if (MainKeys[0]->TimeInMS == MainKeys[1]->TimeInMS && AnimationState == ESpriterAnimationState::PLAYING)
-			{
-				Alpha = 0;
-			}
-			else if (C2 == 0)
-			{
-				Alpha = 0;
-			}
-			else
-			{
-				Alpha = C1 / C2;
-			}
-		}
 
-		for (FSpriterBoxInstance& Box : Boxs)
-		{
-			// Check if Box is Referenced in Mainline
-			if (MainKeys.Num() >= 2)
-			{
-				FSpriterObjectRef* Ref;
-				if (AnimationState == ESpriterAnimationState::BLENDING)
+				// Compared in 2D, the only conversion to an FTransform happens when it is actually pushed
+				if (bFirstPush || !Sprite.PushedTransform2D.Equals(Sprite.PivotedTransform2D, PushTolerance))
 				{
-					if (Alpha == 1)
-					{
-						Ref = GetObjectRef(*NextAnimation, *MainKeys[1], Box.Name);
-					}
-					else
-					{
-						Ref = GetObjectRef(*ActiveAnimation, *MainKeys[0], Box.Name);
-					}
+					Sprite.SpriteComponent->SetRelativeTransform(Sprite.PivotedTransform2D.ToTransform());
+					Sprite.PushedTransform2D = Sprite.PivotedTransform2D;
+					++NumPushedUpdates;
 				}
 				else
 				{
-					if (Alpha == 1)
-					{
-						Ref = GetObjectRef(*ActiveAnimation, *MainKeys[1], Box.Name);
-					}
-					else
-					{
-						Ref = GetObjectRef(*ActiveAnimation, *MainKeys[0], Box.Name);
-					}
+					++NumSkippedUpdates;
 				}
 
-				if (Ref)
+				if (bFirstPush || Sprite.PushedZIndex != Sprite.ZIndex)
 				{
-					Box.IsActive = true;
-
-					FSpriterTimeline* ParentTimeline = nullptr;
-					if (AnimationState == ESpriterAnimationState::BLENDING)
-						{
-							if (Alpha == 1)
-							{
-								ParentTimeline = GetTimeline(*NextAnimation, Ref->ParentTimelineIndex);
-							}
-						}
-					else
-						{
-							ParentTimeline = GetTimeline(*ActiveAnimation, Ref->ParentTimelineIndex);
-						}
-
-					if (ParentTimeline)
-						{
-							Box.ParentBoneName = ParentTimeline->Name;
-						}
-
-					Box.ZIndex = Ref->ZIndex;
+					Sprite.SpriteComponent->SetTranslucentSortPriority(Sprite.ZIndex);
+					Sprite.PushedZIndex = Sprite.ZIndex;
+					++NumPushedUpdates;
 				}
 				else
 				{
-					Box.IsActive = false;
+					++NumSkippedUpdates;
 				}
-			}
 
-			// Update Box if Referenced in Mainline
-			if (Box.IsActive)
-			{
-				const TArray<FSpriterFatTimelineKey*>& Keys = GetTimelineKeys(Box.Name);
-				if (Keys.Num() >= 2)
+				if (bFirstPush || !Sprite.PushedColor.Equals(Sprite.EvaluatedColor, PushTolerance))
 				{
-					// Finding Alpha for Timeline Keys
-					if (AnimationState == ESpriterAnimationState::BLENDING)
-					{
-						C1 = CurrentBlendTimeMS;
-						C2 = BlendDurationMS;
-					}
-					else if (AnimationState == ESpriterAnimationState::PLAYING)
-					{
-						if (Keys[1]->TimeInMS == 0 && ActiveAnimation)
-						{
-							C1 = (CurrentTimeMS - Keys[0]->TimeInMS);
-							C2 = (ActiveAnimation->LengthInMS - Keys[0]->TimeInMS);
-						}
-						else
-						{
-							C1 = (CurrentTimeMS - Keys[0]->TimeInMS);
-							C2 = (Keys[1]->TimeInMS - Keys[0]->TimeInMS);
-						}
-					}
-
-					if (Keys[0]->TimeInMS == Keys[1]->TimeInMS && AnimationState == ESpriterAnimationState::PLAYING)
-					{
-						Alpha = 0;
-					}
-					else if (C2 == 0)
-					{
-						Alpha = 0;
-					}
-					else
-					{
-						Alpha = C1 / C2;
-					}
-
-					// Updating Box from Timeline Keys
-					FTransform RelativeTransform = FTransform();
-					FTransform FirstTransform = Keys[0]->Info.ConvertToTransform();
-					FTransform SecondTransform = Keys[1]->Info.ConvertToTransform();
-					float SpinCorrection = 0;
-					if (Keys[0]->Spin > 0 && (FirstTransform.Rotator().Pitch > SecondTransform.Rotator().Pitch))
-					{
-						SpinCorrection = 360;
-					}
-					else if (Keys[0]->Spin < 0 && (SecondTransform.Rotator().Pitch > FirstTransform.Rotator().Pitch))
-					{
-						SpinCorrection = -360;
-					}
-					Box.Pivot = (Keys[0]->PivotX * PaperAxisX) + (Keys[0]->PivotY * PaperAxisY);
-					FVector FirstPivotOffset = Keys[0]->Info.ConvertToTransform().GetRotation().RotateVector(Box.Pivot);
-					FVector SecondPivotOffset = Keys[1]->Info.ConvertToTransform().GetRotation().RotateVector(Box.Pivot);
-
-					RelativeTransform.SetLocation(FMath::Lerp(FirstTransform.GetLocation() + FirstPivotOffset, SecondTransform.GetLocation() + SecondPivotOffset, Alpha));
-					RelativeTransform.SetRotation(FQuat::Slerp_NotNormalized(FirstTransform.GetRotation(), (SecondTransform.Rotator() + FRotator(SpinCorrection, 0, 0)).Quaternion(), Alpha));
-					RelativeTransform.SetScale3D(FMath::Lerp(Box.Scale * FirstTransform.GetScale3D(), Box.Scale * SecondTransform.GetScale3D(), Alpha));
-
-					Box.RelativeTransform = RelativeTransform;
-					Box.RelativeTransform.SetLocation(Box.RelativeTransform.GetLocation() / Skeleton->PixelsPerUnrealUnit);
-					Box.RelativeTransform.SetScale3D(Box.RelativeTransform.GetScale3D() / Skeleton->PixelsPerUnrealUnit);
-					if (!Box.ParentBoneName.IsEmpty())
-					{
-						FSpriterBoneInstance* Parent = GetBone(Box.ParentBoneName);
-						if (Parent)
-						{
-							FTransform::Multiply(&Box.WorldTransform, &Box.RelativeTransform, &Parent->WorldTransform);
-						}
-					}
-					else
-					{
-						Box.WorldTransform = RelativeTransform;
-					}
+					Sprite.SpriteComponent->SetSpriteColor(Sprite.EvaluatedColor);
+					Sprite.PushedColor = Sprite.EvaluatedColor;
+					++NumPushedUpdates;
 				}
 				else
 				{
-					UE_LOG(LogTemp, Warning, TEXT("USpriterSkeletonComponent_UpdateSprites() : Couldnt Find 2 Timeline Keys!"));
-
-					return;
+					++NumSkippedUpdates;
 				}
 			}
 		}
 	}
 }
 
-void USpriterSkeletonComponent::UpdatePoints()
+void USpriterSkeletonComponent::ApplySpritesBatched()
 {
 	if (IsInitialized(true))
 	{
-		const TArray<FSpriterMainlineKey*>& MainKeys = GetMainlineKeys();
-		float Alpha = 0.f;
-		float C1 = 0.f;
-		float C2 = 0.f;
+		NumPushedUpdates = 0;
+		NumSkippedUpdates = 0;
 
-		// Finding Alpha for Mainline Keys
-		if (MainKeys.Num() >= 2)
+		// The batch is only rebuilt if a Sprite changed past the Tolerance since it was last built
+		bool bChanged = false;
+		for (FSpriterSpriteInstance& Sprite : Sprites)
 		{
-			if (AnimationState == ESpriterAnimationState::BLENDING)
+			const bool bVisible = Sprite.IsActive && Sprite.EvaluatedKey;
+			UPaperSprite* PaperSprite = (bVisible && Sprite.EvaluatedKey->File) ? GetSpriteFromCharacterMap(*Sprite.EvaluatedKey->File) : nullptr;
+
+			if (!Sprite.bPushed || Sprite.bPushedActive != bVisible || (bVisible &&
+				(Sprite.PushedKey != Sprite.EvaluatedKey || Sprite.PushedSprite != PaperSprite || Sprite.PushedZIndex != Sprite.ZIndex ||
+				!Sprite.PushedTransform2D.Equals(Sprite.WorldTransform2D, PushTolerance) || !Sprite.PushedColor.Equals(Sprite.EvaluatedColor, PushTolerance))))
 			{
-				C1 = CurrentBlendTimeMS;
-				C2 = BlendDurationMS;
+				Sprite.bPushed = true;
+				Sprite.bPushedActive = bVisible;
+				Sprite.PushedKey = Sprite.EvaluatedKey;
+				Sprite.PushedSprite = PaperSprite;
+				Sprite.PushedZIndex = Sprite.ZIndex;
+				Sprite.PushedTransform2D = Sprite.WorldTransform2D;
+				Sprite.PushedColor = Sprite.EvaluatedColor;
+
+				bChanged = true;
+				++NumPushedUpdates;
 			}
-			else if (AnimationState == ESpriterAnimationState::PLAYING)
+			else
 			{
-				if (MainKeys[1]->TimeInMS == 0 && ActiveAnimation)
-				{
-					C1 = (CurrentTimeMS - MainKeys[0]->TimeInMS);
-					C2 = (ActiveAnimation->LengthInMS - MainKeys[0]->TimeInMS);
-				}
-				else
-				{
-					C1 = (CurrentTimeMS - MainKeys[0]->TimeInMS);
-					C2 = (MainKeys[1]->TimeInMS - MainKeys[0]->TimeInMS);
-				}
+				++NumSkippedUpdates;
 			}
+		}
 
-			if (MainKeys[0]->TimeInMS == MainKeys[1]->TimeInMS && AnimationState == ESpriterAnimationState::PLAYING)
-			{
-				Alpha = 0;
-			}
-			else if (C2 == 0)
+		if (!bChanged)
+		{
+			return;
+		}
+
+		// Draw lower Z Indexs first, like Translucent Sort Priority does for Sprite Components
+		DrawOrder.Reset();
+		for (int32 SpriteIndex = 0; SpriteIndex < Sprites.Num(); ++SpriteIndex)
+		{
+			if (Sprites[SpriteIndex].bPushedActive)
 			{
-				Alpha = 0;
+				DrawOrder.Add(SpriteIndex);
 			}
-			else
+		}
+		DrawOrder.StableSort([this](int32 A, int32 B) { return Sprites[A].ZIndex < Sprites[B].ZIndex; });
+
+		int32 NumDrawCalls = 0;
+		DrawCalls.SetNum(DrawOrder.Num(), false);
+		DrawCallMaterials.SetNum(DrawOrder.Num(), false);
+		for (int32 SpriteIndex : DrawOrder)
+		{
+			const FSpriterSpriteInstance& Sprite = Sprites[SpriteIndex];
+			const FSpriterFatTimelineKey& Key = *Sprite.EvaluatedKey;
+
+			UPaperSprite* PaperSprite = Sprite.PushedSprite;
+			if (!PaperSprite)
 			{
-				Alpha = C1 / C2;
+				continue;
 			}
+
+			// Vertices are built in component space, so the Render Component can draw them untransformed
+			DrawCallMaterials[NumDrawCalls] = PaperSprite->GetDefaultMaterial();
+			USpriterRenderComponent::BuildDrawCall(DrawCalls[NumDrawCalls++], PaperSprite, Key, Sprite.WorldTransform2D, Sprite.EvaluatedColor);
 		}
+		DrawCalls.SetNum(NumDrawCalls, false);
+		DrawCallMaterials.SetNum(NumDrawCalls, false);
 
-		for (FSpriterPointInstance& Point : Points)
+		RenderComponent->SetDrawCalls(DrawCalls, DrawCallMaterials);
+	}
+}
+
+void USpriterSkeletonComponent::UpdateBoxs()
+{
+	if (IsInitialized(true))
+	{
+		for (int32 BoxIndex = 0; BoxIndex < Boxs.Num(); ++BoxIndex)
 		{
-			// Check if Point is Referenced in Mainline
-			if (MainKeys.Num() >= 2)
+			FSpriterBoxInstance& Box = Boxs[BoxIndex];
+			const int32 Slot = Binding->GetBoxSlot(BoxIndex);
+
+			// Check if Box is Referenced in Mainline
+			if (MainlineKeyPair.IsValid())
 			{
-				FSpriterObjectRef* Ref;
-				if (AnimationState == ESpriterAnimationState::BLENDING)
+				FSpriterAnimation* RefAnimation = nullptr;
+				FSpriterMainlineKey* RefKey = GetRefKey(MainlineKeyPair, RefAnimation);
+				FSpriterObjectRef* Ref = RefAnimation ? GetObjectRef(*RefAnimation, *RefKey, Slot) : nullptr;
+
+				if (Ref)
 				{
-					if (Alpha == 1)
-					{
-						Ref = GetObjectRef(*NextAnimation, *MainKeys[1], Point.Name);
-					}
-					else
-					{
-						Ref = GetObjectRef(*ActiveAnimation, *MainKeys[0], Point.Name);
-					}
+					Box.IsActive = true;
+
+					SetInstanceParentBone(Box, GetRefParentBone(*RefAnimation, *Ref), Bones);
+					Box.ZIndex = Ref->ZIndex;
 				}
 				else
 				{
-					if (Alpha == 1)
-					{
-						Ref = GetObjectRef(*ActiveAnimation, *MainKeys[1], Point.Name);
-					}
-					else
-					{
-						Ref = GetObjectRef(*ActiveAnimation, *MainKeys[0], Point.Name);
-					}
+					Box.IsActive = false;
 				}
+			}
 
-				if (Ref)
+			// Update Box if Referenced in Mainline
+			if (Box.IsActive)
+			{
+				if (Pose.IsSampled(Slot))
 				{
-					Point.IsActive = true;
+					// Updating Box from the Pose, offset by its Pivot
+					const FSpriterTimelineKeyPair& Keys = TimelineKeyPairs[Slot];
+					Box.Pivot = (Keys.First->PivotX * PaperAxisX) + (Keys.First->PivotY * PaperAxisY);
 
-					FSpriterTimeline* ParentTimeline = nullptr;
-					if (AnimationState == ESpriterAnimationState::BLENDING)
-					{
-						if (Alpha == 1)
-						{
-							ParentTimeline = GetTimeline(*NextAnimation, Ref->ParentTimelineIndex);
-						}
-					}
-					else
-					{
-						ParentTimeline = GetTimeline(*ActiveAnimation, Ref->ParentTimelineIndex);
-					}
+					const FVector2D PivotOffset = FMath::Lerp(Keys.First->RotatedPivot, Keys.Second->RotatedPivot, Keys.Alpha);
 
-					if (ParentTimeline)
-					{
-						Point.ParentBoneName = ParentTimeline->Name;
-					}
+					FSpriterTransform2D Relative = Pose.GetTransform(Slot);
+					Relative.X += PivotOffset.X;
+					Relative.Y += PivotOffset.Y;
+					Relative.ScaleX *= FVector::DotProduct(Box.Scale, PaperAxisX) / Skeleton->PixelsPerUnrealUnit;
+					Relative.ScaleY *= FVector::DotProduct(Box.Scale, PaperAxisY) / Skeleton->PixelsPerUnrealUnit;
+					Box.WorldTransform2D = GetWorldTransform2D(Box.ParentBoneIndex, Relative);
 
-					Point.ZIndex = Ref->ZIndex;
+					Box.RelativeTransform = Relative.ToTransform();
+					Box.WorldTransform = Box.WorldTransform2D.ToTransform();
 				}
 				else
 				{
-					Point.IsActive = false;
+					UE_LOG(LogTemp, Warning, TEXT("USpriterSkeletonComponent_UpdateBoxs() : Couldnt Find 2 Timeline Keys!"));
+
+					return;
 				}
 			}
+		}
+	}
+}
 
-			// Update Point if Referenced in Mainline
-			if (Point.IsActive)
-			{
-				const TArray<FSpriterFatTimelineKey*>& Keys = GetTimelineKeys(Point.Name);
-				if (Keys.Num() >= 2)
-				{
-					// Finding Alpha for Timeline Keys
-					if (AnimationState == ESpriterAnimationState::BLENDING)
-					{
-						C1 = CurrentBlendTimeMS;
-						C2 = BlendDurationMS;
-					}
-					else if (AnimationState == ESpriterAnimationState::PLAYING)
-					{
-						if (Keys[1]->TimeInMS == 0 && ActiveAnimation)
-						{
-							C1 = (CurrentTimeMS - Keys[0]->TimeInMS);
-							C2 = (ActiveAnimation->LengthInMS - Keys[0]->TimeInMS);
-						}
-						else
-						{
-							C1 = (CurrentTimeMS - Keys[0]->TimeInMS);
-							C2 = (Keys[1]->TimeInMS - Keys[0]->TimeInMS);
-						}
-					}
+void USpriterSkeletonComponent::UpdatePoints()
+{
+	if (IsInitialized(true))
+	{
+		for (int32 PointIndex = 0; PointIndex < Points.Num(); ++PointIndex)
+		{
+			FSpriterPointInstance& Point = Points[PointIndex];
+			const int32 Slot = Binding->GetPointSlot(PointIndex);
 
-					if (Keys[0]->TimeInMS == Keys[1]->TimeInMS && AnimationState == ESpriterAnimationState::PLAYING)
-					{
-						Alpha = 0;
-					}
-					else if (C2 == 0)
-					{
-						Alpha = 0;
-					}
-					else
-					{
-						Alpha = C1 / C2;
-					}
+			// Check if Point is Referenced in Mainline
+			if (MainlineKeyPair.IsValid())
+			{
+				FSpriterAnimation* RefAnimation = nullptr;
+				FSpriterMainlineKey* RefKey = GetRefKey(MainlineKeyPair, RefAnimation);
+				FSpriterObjectRef* Ref = RefAnimation ? GetObjectRef(*RefAnimation, *RefKey, Slot) : nullptr;
 
-					// Updating Point from Timeline Keys
-					FTransform RelativeTransform = FTransform();
-					FTransform FirstTransform = Keys[0]->Info.ConvertToTransform();
-					FTransform SecondTransform = Keys[1]->Info.ConvertToTransform();
-					float SpinCorrection = 0;
-					if (Keys[0]->Spin > 0 && (FirstTransform.Rotator().Pitch > SecondTransform.Rotator().Pitch))
-					{
-						SpinCorrection = 360;
-					}
-					else if (Keys[0]->Spin < 0 && (SecondTransform.Rotator().Pitch > FirstTransform.Rotator().Pitch))
-					{
-						SpinCorrection = -360;
-					}
+				if (Ref)
+				{
+					Point.IsActive = true;
 
-					RelativeTransform.SetLocation(FMath::Lerp(FirstTransform.GetLocation(), SecondTransform.GetLocation(), Alpha));
-					RelativeTransform.SetRotation(FQuat::Slerp_NotNormalized(FirstTransform.GetRotation(), (SecondTransform.Rotator() + FRotator(SpinCorrection, 0, 0)).Quaternion(), Alpha));
-					RelativeTransform.SetScale3D(FMath::Lerp(FirstTransform.GetScale3D(), SecondTransform.GetScale3D(), Alpha));
+					SetInstanceParentBone(Point, GetRefParentBone(*RefAnimation, *Ref), Bones);
+					Point.ZIndex = Ref->ZIndex;
+				}
+				else
+				{
+					Point.IsActive = false;
+				}
+			}
 
-					Point.RelativeTransform = RelativeTransform;
-					Point.RelativeTransform.SetLocation(Point.RelativeTransform.GetLocation() / Skeleton->PixelsPerUnrealUnit);
-					if (!Point.ParentBoneName.IsEmpty())
-					{
-						FSpriterBoneInstance* Parent = GetBone(Point.ParentBoneName);
-						if (Parent)
-						{
-							FTransform::Multiply(&Point.WorldTransform, &Point.RelativeTransform, &Parent->WorldTransform);
-						}
-					}
-					else
-					{
-						Point.WorldTransform = RelativeTransform;
-					}
+			// Update Point if Referenced in Mainline
+			if (Point.IsActive)
+			{
+				if (Pose.IsSampled(Slot))
+				{
+					const FSpriterTransform2D Relative = Pose.GetTransform(Slot);
+					Point.WorldTransform2D = GetWorldTransform2D(Point.ParentBoneIndex, Relative);
+
+					Point.RelativeTransform = Relative.ToTransform();
+					Point.WorldTransform = Point.WorldTransform2D.ToTransform();
 				}
 				else
 				{
-					UE_LOG(LogTemp, Warning, TEXT("USpriterSkeletonComponent_UpdateSprites() : Couldnt Find 2 Timeline Keys!"));
+					UE_LOG(LogTemp, Warning, TEXT("USpriterSkeletonComponent_UpdatePoints() : Couldnt Find 2 Timeline Keys!"));
 
 					return;
 				}
@@ -1246,31 +1770,137 @@ void USpriterSkeletonComponent::UpdatePoints()
 
 void USpriterSkeletonComponent::UpdateEvents()
 {
-	if (IsInitialized(true))
+	if (IsInitialized(true) && ActiveAnimation)
+	{
+		// A new Animation starts its window before its first Key, so Keys at 0 fire too
+		if (EventAnimation != ActiveAnimation)
+		{
+			EventAnimation = ActiveAnimation;
+			EventTimeMS = -1.f;
+		}
+
+		// Time only moves back on its own through a Loop, which AdvanceAnimation finishes, anything else is a Seek and fires nothing
+		if (CurrentTimeMS < EventTimeMS)
+		{
+			EventTimeMS = CurrentTimeMS;
+		}
+
+		QueueEvents(EventTimeMS, CurrentTimeMS);
+		EventTimeMS = CurrentTimeMS;
+
+		BroadcastPendingEvents();
+	}
+}
+
+void USpriterSkeletonComponent::QueueEvents(float StartMS, float EndMS)
+{
+	const FSpriterAnimationBinding* CurrentBinding = GetAnimationBinding(ActiveAnimation);
+	if (!CurrentBinding || EndMS <= StartMS)
+	{
+		return;
+	}
+
+	for (int32 EventIndex = 0; EventIndex < Events.Num(); ++EventIndex)
 	{
+		const int32 EventLineIndex = CurrentBinding->EventLines[EventIndex];
+		FSpriterEventLine* EventLine = GetEventLine(*ActiveAnimation, EventLineIndex);
+		if (!EventLine)
+		{
+			continue;
+		}
 
-		// Update Events
-		for (FSpriterEventInstance& Event : Events)
+		// The Cursor lands on the last Key at or before StartMS, everything after it up to EndMS is in the window
+		int32 Key = FSpriterPlaybackCursor::FindKey(EventLine->Keys, StartMS, GetPlaybackCursor().EventLineKeys[EventLineIndex]) + 1;
+		for (; Key < EventLine->Keys.Num() && EventLine->Keys[Key].TimeInMS <= EndMS; ++Key)
 		{
-			const TArray<FSpriterEventLineKey*>& Keys = GetEventLineKeys(Event.Name);
+			FSpriterPendingEvent PendingEvent;
+			PendingEvent.TimeMS = EventLine->Keys[Key].TimeInMS;
+			PendingEvent.EventIndex = EventIndex;
+			PendingEvents.Add(PendingEvent);
+		}
+	}
+}
+
+void USpriterSkeletonComponent::BroadcastPendingEvents()
+{
+	if (PendingEvents.Num() == 0)
+	{
+		return;
+	}
+
+	PendingEvents.StableSort([](const FSpriterPendingEvent& A, const FSpriterPendingEvent& B) { return A.TimeMS < B.TimeMS; });
 
-			if (Keys.Num() >= 2)
+	for (int32 PendingIndex = 0; PendingIndex < PendingEvents.Num(); ++PendingIndex)
+	{
+		const FSpriterPendingEvent PendingEvent = PendingEvents[PendingIndex];
+		if (Events.IsValidIndex(PendingEvent.EventIndex))
+		{
+			Events[PendingEvent.EventIndex].PreviousCallTimeMS = PendingEvent.TimeMS;
+			if (OnEvent.IsBound())
 			{
-				// Check for Event Call
-				if (Event.PreviousCallTimeMS < Keys[0]->TimeInMS)
-				{
-					OnEvent.Broadcast(this, Event.Name);
-					Event.PreviousCallTimeMS = Keys[0]->TimeInMS;
-				}
+				OnEvent.Broadcast(this, Events[PendingEvent.EventIndex].Name);
 			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("USpriterSkeletonComponent_UpdateEvents() : Couldnt Find 2 Event Line Keys!"));
+		}
+	}
 
-				return;
-			}
+	PendingEvents.Reset();
+}
+
+bool USpriterSkeletonComponent::WasRecentlyRendered(float Timeout) const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return true;
+	}
+
+	// Nothing can have been rendered before it was pushed, so a fresh Skeleton counts as visible until every Sprite had its chance
+	for (const FSpriterSpriteInstance& Sprite : Sprites)
+	{
+		if (!Sprite.bPushed)
+		{
+			return true;
+		}
+	}
+
+	const float RenderedAfter = World->GetTimeSeconds() - Timeout;
+	if (RenderComponent)
+	{
+		return RenderComponent->LastRenderTime >= RenderedAfter;
+	}
+
+	for (const FSpriterSpriteInstance& Sprite : Sprites)
+	{
+		if (Sprite.SpriteComponent && Sprite.SpriteComponent->LastRenderTime >= RenderedAfter)
+		{
+			return true;
+		}
+	}
+
+	// A Skeleton without Sprites has nothing to hide
+	return Sprites.Num() == 0;
+}
+
+float USpriterSkeletonComponent::GetDistanceToClosestCamera() const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return MAX_FLT;
+	}
+
+	float ClosestDistanceSquared = MAX_FLT;
+	const FVector Location = GetComponentLocation();
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		APlayerController* PlayerController = *Iterator;
+		if (PlayerController && PlayerController->PlayerCameraManager)
+		{
+			ClosestDistanceSquared = FMath::Min(ClosestDistanceSquared, FVector::DistSquared(Location, PlayerController->PlayerCameraManager->GetCameraLocation()));
 		}
 	}
+
+	return (ClosestDistanceSquared < MAX_FLT) ? FMath::Sqrt(ClosestDistanceSquared) : MAX_FLT;
 }
 
 void USpriterSkeletonComponent::CleanupObjects()
@@ -1279,15 +1909,119 @@ void USpriterSkeletonComponent::CleanupObjects()
 	{
 		if (Sprite.SpriteComponent)
 		{
-			Sprite.SpriteComponent->DestroyComponent();
+			ReleaseSpriteComponent(Sprite.SpriteComponent);
 		}
 	}
 
+	if (RenderComponent)
+	{
+		RenderComponent->DestroyComponent();
+		RenderComponent = nullptr;
+	}
+
 	Bones.Empty();
 	Sprites.Empty();
 	Boxs.Empty();
 	Points.Empty();
 	Events.Empty();
+
+	Binding = &FSpriterSkeletonBinding::GetEmpty();
+	TimelineKeyPairs.Empty();
+	MainlineKeyPair.Reset();
+	Pose.Empty();
+}
+
+void USpriterSkeletonComponent::PrewarmSpriteComponents(int32 Count)
+{
+	if (Count <= 0 && Skeleton)
+	{
+		// Same search InitSkeleton does, Sprites only show up in Timelines
+		TArray<FString> SpriteNames;
+		for (FSpriterEntity& Entity : Skeleton->ImportedData.Entities)
+		{
+			SpriteNames.Reset();
+			for (FSpriterAnimation& Animation : Entity.Animations)
+			{
+				for (FSpriterTimeline& Timeline : Animation.Timelines)
+				{
+					if (Timeline.ObjectType == ESpriterObjectType::Sprite)
+					{
+						SpriteNames.AddUnique(Timeline.Name);
+					}
+				}
+			}
+
+			Count = FMath::Max(Count, SpriteNames.Num());
+		}
+	}
+
+	Count = FMath::Min(Count, MaxPooledSpriteComponents);
+	while (SpriteComponentPool.Num() < Count)
+	{
+		SpriteComponentPool.Add(CreateSpriteComponent(TEXT("PooledSprite")));
+	}
+}
+
+void USpriterSkeletonComponent::EmptySpriteComponentPool()
+{
+	for (UPaperSpriteComponent* SpriteComponent : SpriteComponentPool)
+	{
+		if (SpriteComponent && !SpriteComponent->IsPendingKill())
+		{
+			SpriteComponent->DestroyComponent();
+		}
+	}
+
+	SpriteComponentPool.Empty();
+}
+
+UPaperSpriteComponent* USpriterSkeletonComponent::AcquireSpriteComponent(const FString& SpriteName)
+{
+	while (SpriteComponentPool.Num() > 0)
+	{
+		// Stays hidden until ApplySprites first pushes the Sprite using it
+		UPaperSpriteComponent* SpriteComponent = SpriteComponentPool.Pop(false);
+		if (SpriteComponent && !SpriteComponent->IsPendingKill())
+		{
+			return SpriteComponent;
+		}
+	}
+
+	return CreateSpriteComponent(SpriteName);
+}
+
+void USpriterSkeletonComponent::ReleaseSpriteComponent(UPaperSpriteComponent* SpriteComponent)
+{
+	if (SpriteComponent->IsPendingKill())
+	{
+		return;
+	}
+
+	if (SpriteComponentPool.Num() < MaxPooledSpriteComponents)
+	{
+		// Kept registered and attached, only hidden and emptied, so the next Entity never shows this one's art
+		SpriteComponent->SetVisibility(false);
+		SpriteComponent->SetSprite(nullptr);
+		SpriteComponentPool.Add(SpriteComponent);
+	}
+	else
+	{
+		SpriteComponent->DestroyComponent();
+	}
+}
+
+UPaperSpriteComponent* USpriterSkeletonComponent::CreateSpriteComponent(const FString& SpriteName)
+{
+	// Pooled Components keep the Name they were created with, so the Name has to be made unique
+	const FName ComponentName = MakeUniqueObjectName((UObject*)Owner, UPaperSpriteComponent::StaticClass(), FName(*SpriteName));
+
+	UPaperSpriteComponent* SpriteComponent = NewObject<UPaperSpriteComponent>((UObject*)Owner, ComponentName);
+	SpriteComponent->AttachTo(this);
+	SpriteComponent->bWantsBeginPlay = true;
+	SpriteComponent->SetVisibility(false);
+	SpriteComponent->RegisterComponent();
+
+	return SpriteComponent;
 }
 
 void USpriterSkeletonComponent::CleanupObjectData()
@@ -1296,6 +2030,9 @@ void USpriterSkeletonComponent::CleanupObjectData()
 	{
 		Event.PreviousCallTimeMS = INDEX_NONE;
 	}
+
+	EventTimeMS = -1.f;
+	EventAnimation = nullptr;
 }
 
 
@@ -1435,31 +2172,18 @@ UPaperSprite* USpriterSkeletonComponent::GetSpriteFromCharacterMap(UPARAM(ref)FS
 
 	if (Skeleton && CharacterMap)
 	{
-		TArray<FString> StringArray;
-		TArray<FString> NameArray;
-		FString AssociatedSprite;
-		File.Name.ParseIntoArray(StringArray, TEXT("/"));
-		StringArray.Last(0).ParseIntoArray(NameArray, TEXT("."));
-
-		if (NameArray.Num() > 0)
-		{
-			AssociatedSprite = NameArray[0];
-		}
-		else
+		if (CharacterMap != ResolvedCharacterMap || Skeleton != ResolvedSkeleton || CharacterMap->GetChangeCount() != ResolvedChangeCount)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("USpriterSkeletonComponent_GetSpriteFromCharacterMap() : Couldnt Get Associated Name!"));
-
-			return nullptr;
+			ResolveCharacterMap();
 		}
 
-		for (FSpriterCharacterMapEntry& Entry : CharacterMap->Entrys)
+		// Files made outside the Skeleton (like in Blueprints) have no Table Index, they're looked up by Name
+		if (File.TableIndex == INDEX_NONE)
 		{
-			if (Entry.AssociatedSprite.Equals(AssociatedSprite, ESearchCase::IgnoreCase))
-			{
-				return Entry.ResultSprite;
-			}
+			return CharacterMap->FindSprite(File);
 		}
 
+		return ResolvedSprites.IsValidIndex(File.TableIndex) ? ResolvedSprites[File.TableIndex] : nullptr;
 	}
 
 	return nullptr;
@@ -1492,6 +2216,8 @@ void USpriterSkeletonComponent::GetSprite(int32 SpriteIndex, FSpriterSpriteInsta
 	if (SpriteP)
 	{
 		Sprite = *SpriteP;
+		Sprite.RelativeTransform = Sprite.RelativeTransform2D.ToTransform();
+		Sprite.WorldTransform = Sprite.WorldTransform2D.ToTransform();
 	}
 }
 
@@ -1501,6 +2227,8 @@ void USpriterSkeletonComponent::GetSpriteByName(const FString& SpriteName, FSpri
 	if (SpriteP)
 	{
 		Sprite = *SpriteP;
+		Sprite.RelativeTransform = Sprite.RelativeTransform2D.ToTransform();
+		Sprite.WorldTransform = Sprite.WorldTransform2D.ToTransform();
 	}
 }
 
@@ -1561,177 +2289,166 @@ void USpriterSkeletonComponent::GetEventByName(const FString& EventName, FSprite
 
 // Animation Dependant Grabbers
 
-TArray<FSpriterMainlineKey*> USpriterSkeletonComponent::GetMainlineKeys()
+bool USpriterSkeletonComponent::GetMainlineKeys(FSpriterMainlineKeyPair& OutKeys)
 {
+	OutKeys.Reset();
+
 	if (Skeleton)
 	{
-		TArray<FSpriterMainlineKey*> MainlineKeys  = TArray<FSpriterMainlineKey*>();
-		FSpriterMainlineKey* C1;
-		FSpriterMainlineKey* C2;
-
 		if (AnimationState == ESpriterAnimationState::BLENDING)
 		{
-			if (ActiveAnimation && NextAnimation)
+			if (ActiveAnimation && NextAnimation && NextAnimation->MainlineKeys.Num() > 0)
 			{
-				for (FSpriterMainlineKey& Key : ActiveAnimation->MainlineKeys)
+				const int32 Key = FSpriterPlaybackCursor::FindKey(ActiveAnimation->MainlineKeys, CurrentTimeMS, GetPlaybackCursor().MainlineKey);
+				if (Key != INDEX_NONE)
 				{
-					if (Key.TimeInMS <= CurrentTimeMS)
-					{
-						C1 = &Key;
-					}
+					OutKeys.First = &ActiveAnimation->MainlineKeys[Key];
+					OutKeys.Second = &NextAnimation->MainlineKeys[0];
 				}
-
-				C2 = &NextAnimation->MainlineKeys[0];
 			}
 		}
 		else if (AnimationState == ESpriterAnimationState::PLAYING)
 		{
 			if (ActiveAnimation)
 			{
-				for (int32 Key = 0; Key < ActiveAnimation->MainlineKeys.Num(); ++Key)
+				const int32 Key = FSpriterPlaybackCursor::FindKey(ActiveAnimation->MainlineKeys, CurrentTimeMS, GetPlaybackCursor().MainlineKey);
+				if (Key != INDEX_NONE)
 				{
-					if (ActiveAnimation->MainlineKeys[Key].TimeInMS <= CurrentTimeMS)
-					{
-						C1 = &ActiveAnimation->MainlineKeys[Key];
-						C2 = &ActiveAnimation->MainlineKeys[(Key + 1) % ActiveAnimation->MainlineKeys.Num()];
-					}
+					OutKeys.First = &ActiveAnimation->MainlineKeys[Key];
+					OutKeys.Second = &ActiveAnimation->MainlineKeys[(Key + 1) % ActiveAnimation->MainlineKeys.Num()];
 				}
 			}
 		}
 
-		MainlineKeys.Add(C1);
-		MainlineKeys.Add(C2);
-
-		return MainlineKeys;
+		if (OutKeys.IsValid())
+		{
+			OutKeys.Alpha = GetKeyAlpha(OutKeys.First->TimeInMS, OutKeys.Second->TimeInMS);
+			return true;
+		}
 	}
 
-	return TArray<FSpriterMainlineKey*>();
+	return false;
 }
 
-TArray<FSpriterFatTimelineKey*> USpriterSkeletonComponent::GetTimelineKeys(const FString& ObjectName)
+bool USpriterSkeletonComponent::GetTimelineKeys(int32 ObjectSlot, FSpriterTimelineKeyPair& OutKeys)
 {
-	if (Skeleton && !ObjectName.IsEmpty())
-	{
-		FSpriterTimeline* CurrentTimeline;
-		FSpriterTimeline* NextTimeline;
-		TArray<FSpriterFatTimelineKey*> Keys = TArray<FSpriterFatTimelineKey*>();
-		FSpriterFatTimelineKey* C1;
-		FSpriterFatTimelineKey* C2;
+	OutKeys.Reset();
 
-		if (AnimationState == ESpriterAnimationState::BLENDING)
+	const FSpriterAnimationBinding* CurrentBinding = GetAnimationBinding(ActiveAnimation);
+	if (CurrentBinding && ObjectSlot != INDEX_NONE)
+	{
+		const int32 TimelineIndex = CurrentBinding->ObjectTimelines[ObjectSlot];
+		FSpriterTimeline* CurrentTimeline = GetTimeline(*ActiveAnimation, TimelineIndex);
+		if (CurrentTimeline)
 		{
-			if (ActiveAnimation && NextAnimation)
+			const float TimeMS = (AnimationState == ESpriterAnimationState::PLAYING) ? EasedTimeMS : CurrentTimeMS;
+			const int32 Key = FSpriterPlaybackCursor::FindKey(CurrentTimeline->Keys, TimeMS, GetPlaybackCursor().TimelineKeys[TimelineIndex]);
+			if (Key != INDEX_NONE)
 			{
-				CurrentTimeline = GetTimeline(*ActiveAnimation, ObjectName);
-				NextTimeline = GetTimeline(*NextAnimation, ObjectName);
-				if (CurrentTimeline && NextTimeline)
+				if (AnimationState == ESpriterAnimationState::BLENDING)
 				{
-					for (FSpriterFatTimelineKey& Key : CurrentTimeline->Keys)
+					const FSpriterAnimationBinding* NextBinding = GetAnimationBinding(NextAnimation);
+					FSpriterTimeline* NextTimeline = NextBinding ? GetTimeline(*NextAnimation, NextBinding->ObjectTimelines[ObjectSlot]) : nullptr;
+					if (NextTimeline && NextTimeline->Keys.Num() > 0)
 					{
-						if (Key.TimeInMS <= CurrentTimeMS)
-						{
-							C1 = &Key;
-						}
+						OutKeys.First = &CurrentTimeline->Keys[Key];
+						OutKeys.Second = &NextTimeline->Keys[0];
 					}
-
-					C2 = &NextTimeline->Keys[0];
-
-					Keys.Add(C1);
-					Keys.Add(C2);
-
-					return Keys;
+				}
+				else
+				{
+					OutKeys.First = &CurrentTimeline->Keys[Key];
+					OutKeys.Second = &CurrentTimeline->Keys[(Key + 1) % CurrentTimeline->Keys.Num()];
 				}
 			}
 		}
+	}
+
+	if (OutKeys.IsValid())
+	{
+		// Blends stay linear, Keys of a playing Animation follow their Curve at the eased time
+		if (AnimationState == ESpriterAnimationState::PLAYING && ActiveAnimation)
+		{
+			const float Alpha = FSpriterPlaybackCursor::GetPlayingAlpha(EasedTimeMS, OutKeys.First->TimeInMS, OutKeys.Second->TimeInMS, ActiveAnimation->LengthInMS);
+			OutKeys.Alpha = FSpriterCurve::EaseTimelineAlpha(*OutKeys.First, Alpha);
+		}
 		else
 		{
-			if (ActiveAnimation)
-			{
-				CurrentTimeline = GetTimeline(*ActiveAnimation, ObjectName);
-				if (CurrentTimeline)
-				{
-					for (int Key = 0; Key < CurrentTimeline->Keys.Num(); ++Key)
-					{
-						if (CurrentTimeline->Keys[Key].TimeInMS <= CurrentTimeMS)
-						{
-							C1 = &CurrentTimeline->Keys[Key];
-							C2 = &CurrentTimeline->Keys[(Key + 1) % CurrentTimeline->Keys.Num()];
-						}
-					}
+			OutKeys.Alpha = GetKeyAlpha(OutKeys.First->TimeInMS, OutKeys.Second->TimeInMS);
+		}
 
-					Keys.Add(C1);
-					Keys.Add(C2);
+		return true;
+	}
 
-					return Keys;
-				}
-			}
-		}
+	return false;
+}
+
+float USpriterSkeletonComponent::GetKeyAlpha(int32 FirstTimeMS, int32 SecondTimeMS) const
+{
+	if (AnimationState == ESpriterAnimationState::BLENDING)
+	{
+		return (BlendDurationMS != 0) ? (CurrentBlendTimeMS / BlendDurationMS) : 0.f;
+	}
+	else if (AnimationState == ESpriterAnimationState::PLAYING && ActiveAnimation)
+	{
+		return FSpriterPlaybackCursor::GetPlayingAlpha(CurrentTimeMS, FirstTimeMS, SecondTimeMS, ActiveAnimation->LengthInMS);
 	}
 
-	return TArray<FSpriterFatTimelineKey*>();
+	return 0.f;
 }
 
-TArray<FSpriterEventLineKey*> USpriterSkeletonComponent::GetEventLineKeys(const FString& EventName)
+FSpriterMainlineKey* USpriterSkeletonComponent::GetRefKey(const FSpriterMainlineKeyPair& MainKeys, FSpriterAnimation*& OutAnimation)
 {
-	if (Skeleton && !EventName.IsEmpty())
+	// Refs only switch over to the Second Key once it has been fully reached
+	if (MainKeys.Alpha == 1)
 	{
-		FSpriterEventLine* CurrentTimeline;
-		FSpriterEventLine* NextTimeline;
-		TArray<FSpriterEventLineKey*> Keys = TArray<FSpriterEventLineKey*>();
-		FSpriterEventLineKey* C1;
-		FSpriterEventLineKey* C2;
+		OutAnimation = (AnimationState == ESpriterAnimationState::BLENDING) ? NextAnimation : ActiveAnimation;
+		return MainKeys.Second;
+	}
 
-		if (AnimationState == ESpriterAnimationState::BLENDING)
-		{
-			if (ActiveAnimation && NextAnimation)
-			{
-				CurrentTimeline = GetEventLine(*ActiveAnimation, EventName);
-				NextTimeline = GetEventLine(*NextAnimation, EventName);
-				if (CurrentTimeline && NextTimeline)
-				{
-					for (FSpriterEventLineKey& Key : CurrentTimeline->Keys)
-					{
-						if (Key.TimeInMS <= CurrentTimeMS)
-						{
-							C1 = &Key;
-						}
-					}
+	OutAnimation = ActiveAnimation;
+	return MainKeys.First;
+}
+
+FSpriterTransform2D USpriterSkeletonComponent::GetWorldTransform2D(int32 ParentBoneIndex, const FSpriterTransform2D& RelativeTransform) const
+{
+	if (Bones.IsValidIndex(ParentBoneIndex))
+	{
+		return Bones[ParentBoneIndex].WorldTransform2D.Compose(RelativeTransform);
+	}
 
-					C2 = &NextTimeline->Keys[0];
+	return RelativeTransform;
+}
 
-					Keys.Add(C1);
-					Keys.Add(C2);
+FSpriterPlaybackCursor& USpriterSkeletonComponent::GetPlaybackCursor()
+{
+	if (PlaybackCursor.Animation != ActiveAnimation)
+	{
+		PlaybackCursor.Reset(ActiveAnimation);
+	}
 
-					return Keys;
-				}
-			}
-		}
-		else
-		{
-			if (ActiveAnimation)
-			{
-				CurrentTimeline = GetEventLine(*ActiveAnimation, EventName);
-				if (CurrentTimeline)
-				{
-					for (int Key = 0; Key < CurrentTimeline->Keys.Num(); ++Key)
-					{
-						if (CurrentTimeline->Keys[Key].TimeInMS <= CurrentTimeMS)
-						{
-							C1 = &CurrentTimeline->Keys[Key];
-							C2 = &CurrentTimeline->Keys[(Key + 1) % CurrentTimeline->Keys.Num()];
-						}
-					}
+	return PlaybackCursor;
+}
 
-					Keys.Add(C1);
-					Keys.Add(C2);
+const FSpriterAnimationBinding* USpriterSkeletonComponent::GetAnimationBinding(const FSpriterAnimation* Animation) const
+{
+	if (Skeleton && ActiveEntity && Animation)
+	{
+		return Binding->GetAnimationBinding(*ActiveEntity, Animation);
+	}
 
-					return Keys;
-				}
-			}
-		}
+	return nullptr;
+}
+
+int32 USpriterSkeletonComponent::GetRefParentBone(const FSpriterAnimation& Animation, const FSpriterRefCommon& Ref) const
+{
+	const FSpriterAnimationBinding* AnimationBinding = GetAnimationBinding(&Animation);
+	if (AnimationBinding)
+	{
+		return Binding->SlotToBone(AnimationBinding->GetTimelineObject(Ref.ParentTimelineIndex));
 	}
 
-	return TArray<FSpriterEventLineKey*>();
+	return INDEX_NONE;
 }
 
 
@@ -1902,6 +2619,40 @@ FSpriterObjectRef* USpriterSkeletonComponent::GetObjectRef(FSpriterAnimation& An
 	return nullptr;
 }
 
+FSpriterRef* USpriterSkeletonComponent::GetBoneRef(FSpriterAnimation& Animation, FSpriterMainlineKey& Key, int32 BoneIndex)
+{
+	const FSpriterAnimationBinding* AnimationBinding = GetAnimationBinding(&Animation);
+	if (AnimationBinding && Animation.MainlineKeys.Num() > 0)
+	{
+		const int32 KeyIndex = &Key - Animation.MainlineKeys.GetData();
+		const int32 RefIndex = AnimationBinding->GetRefIndex(KeyIndex, Binding->GetBoneSlot(BoneIndex));
+
+		if (Key.BoneRefs.IsValidIndex(RefIndex))
+		{
+			return &Key.BoneRefs[RefIndex];
+		}
+	}
+
+	return nullptr;
+}
+
+FSpriterObjectRef* USpriterSkeletonComponent::GetObjectRef(FSpriterAnimation& Animation, FSpriterMainlineKey& Key, int32 ObjectSlot)
+{
+	const FSpriterAnimationBinding* AnimationBinding = GetAnimationBinding(&Animation);
+	if (AnimationBinding && Animation.MainlineKeys.Num() > 0)
+	{
+		const int32 KeyIndex = &Key - Animation.MainlineKeys.GetData();
+		const int32 RefIndex = AnimationBinding->GetRefIndex(KeyIndex, ObjectSlot);
+
+		if (Key.ObjectRefs.IsValidIndex(RefIndex))
+		{
+			return &Key.ObjectRefs[RefIndex];
+		}
+	}
+
+	return nullptr;
+}
+
 FSpriterObjectInfo* USpriterSkeletonComponent::GetObjectInfo(int32 ObjectIndex)
 {
 	if (Skeleton)
@@ -0,0 +1,93 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterTransform2D.h"
+
+
+FSpriterTransform2D::FSpriterTransform2D()
+	: X(0.f)
+	, Y(0.f)
+	, Angle(0.f)
+	, ScaleX(1.f)
+	, ScaleY(1.f)
+{
+}
+
+FSpriterTransform2D::FSpriterTransform2D(float InX, float InY, float InAngle, float InScaleX, float InScaleY)
+	: X(InX)
+	, Y(InY)
+	, Angle(InAngle)
+	, ScaleX(InScaleX)
+	, ScaleY(InScaleY)
+{
+}
+
+FSpriterTransform2D FSpriterTransform2D::Compose(const FSpriterTransform2D& Child) const
+{
+	float Sin = 0.f;
+	float Cos = 1.f;
+	FMath::SinCos(&Sin, &Cos, FMath::DegreesToRadians(Angle));
+
+	// Rotation times Scale, the Translation column is X and Y
+	const float M00 = Cos * ScaleX;
+	const float M01 = -Sin * ScaleY;
+	const float M10 = Sin * ScaleX;
+	const float M11 = Cos * ScaleY;
+
+	FSpriterTransform2D Result;
+	Result.X = (M00 * Child.X) + (M01 * Child.Y) + X;
+	Result.Y = (M10 * Child.X) + (M11 * Child.Y) + Y;
+	Result.Angle = Angle + (((ScaleX * ScaleY) < 0.f) ? -Child.Angle : Child.Angle);
+	Result.ScaleX = ScaleX * Child.ScaleX;
+	Result.ScaleY = ScaleY * Child.ScaleY;
+
+	return Result;
+}
+
+void FSpriterTransform2D::GetAxes(FVector2D& OutAxisX, FVector2D& OutAxisY) const
+{
+	float Sin = 0.f;
+	float Cos = 1.f;
+	FMath::SinCos(&Sin, &Cos, FMath::DegreesToRadians(Angle));
+
+	OutAxisX = FVector2D(Cos * ScaleX, Sin * ScaleX);
+	OutAxisY = FVector2D(-Sin * ScaleY, Cos * ScaleY);
+}
+
+FTransform FSpriterTransform2D::ToTransform() const
+{
+	FTransform Result;
+	Result.SetTranslation((X * PaperAxisX) + (Y * PaperAxisY));
+	Result.SetRotation(FRotator(Angle, 0.0f, 0.0f).Quaternion());
+	Result.SetScale3D((ScaleX * PaperAxisX) + (ScaleY * PaperAxisY) + (PaperAxisZ * -1.0f));
+
+	return Result;
+}
+
+bool FSpriterTransform2D::Equals(const FSpriterTransform2D& Other, float Tolerance) const
+{
+	return FMath::Abs(X - Other.X) <= Tolerance
+		&& FMath::Abs(Y - Other.Y) <= Tolerance
+		&& FMath::Abs(FRotator::NormalizeAxis(Angle - Other.Angle)) <= Tolerance
+		&& FMath::Abs(ScaleX - Other.ScaleX) <= Tolerance
+		&& FMath::Abs(ScaleY - Other.ScaleY) <= Tolerance;
+}
+
+float FSpriterTransform2D::LerpAngle(float FirstAngle, float SecondAngle, int32 Spin, float Alpha)
+{
+	if (Spin == 0)
+	{
+		return FirstAngle;
+	}
+
+	if (Spin > 0 && (SecondAngle - FirstAngle) < 0)
+	{
+		SecondAngle += 360.f;
+	}
+	else if (Spin < 0 && (SecondAngle - FirstAngle) > 0)
+	{
+		SecondAngle -= 360.f;
+	}
+
+	return FMath::Lerp(FirstAngle, SecondAngle, Alpha);
+}
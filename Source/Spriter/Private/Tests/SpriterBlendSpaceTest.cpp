@@ -0,0 +1,130 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterTestData.h"
+#include "SpriterBlendSpace.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Helpers
+
+static USpriterBlendSpace* CreateBlendSpace(const TArray<FVector2D>& Positions, bool bIs2D)
+{
+	USpriterBlendSpace* BlendSpace = NewObject<USpriterBlendSpace>(GetTransientPackage());
+	BlendSpace->bIs2D = bIs2D;
+
+	for (const FVector2D& Position : Positions)
+	{
+		FSpriterBlendSample Sample;
+		Sample.AnimationName = TEXT("Walk");
+		Sample.Position = Position;
+		BlendSpace->Samples.Add(Sample);
+	}
+
+	return BlendSpace;
+}
+
+// Returns the Weight of a Sample, 0 if it doesnt contribute
+static float GetWeight(const TArray<FSpriterBlendSampleWeight>& Weights, int32 SampleIndex)
+{
+	const FSpriterBlendSampleWeight* SampleWeight = Weights.FindByPredicate([SampleIndex](const FSpriterBlendSampleWeight& Candidate) { return Candidate.SampleIndex == SampleIndex; });
+	return SampleWeight ? SampleWeight->Weight : 0.f;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterBlendSpace1DTest, "Spriter.BlendSpace.Weights1D", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterBlendSpace1DTest::RunTest(const FString& Parameters)
+{
+	TArray<FVector2D> Positions;
+	Positions.Add(FVector2D(0.f, 0.f));
+	Positions.Add(FVector2D(100.f, 0.f));
+	Positions.Add(FVector2D(200.f, 0.f));
+	USpriterBlendSpace* BlendSpace = CreateBlendSpace(Positions, false);
+
+	TArray<FSpriterBlendSampleWeight> Weights;
+
+	BlendSpace->GetSampleWeights(FVector2D(50.f, 0.f), Weights);
+	TestEqual(TEXT("Samples between two neighbours"), Weights.Num(), 2);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Left neighbour"), GetWeight(Weights, 0), 0.5f);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Right neighbour"), GetWeight(Weights, 1), 0.5f);
+
+	BlendSpace->GetSampleWeights(FVector2D(175.f, 0.f), Weights);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Linear between neighbours"), GetWeight(Weights, 1), 0.25f);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Linear between neighbours"), GetWeight(Weights, 2), 0.75f);
+	TestEqual(TEXT("Heaviest first"), Weights.Num() > 0 ? Weights[0].SampleIndex : INDEX_NONE, 2);
+
+	BlendSpace->GetSampleWeights(FVector2D(100.f, 0.f), Weights);
+	TestEqual(TEXT("Samples on a Sample"), Weights.Num(), 1);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Exact on a Sample"), GetWeight(Weights, 1), 1.f);
+
+	BlendSpace->GetSampleWeights(FVector2D(-50.f, 0.f), Weights);
+	TestEqual(TEXT("Samples before the first"), Weights.Num(), 1);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Clamped to the first Sample"), GetWeight(Weights, 0), 1.f);
+
+	// Y is ignored by a 1D Blend Space
+	BlendSpace->GetSampleWeights(FVector2D(50.f, 1000.f), Weights);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Y ignored"), GetWeight(Weights, 0), 0.5f);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Y ignored"), GetWeight(Weights, 1), 0.5f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterBlendSpace2DTest, "Spriter.BlendSpace.Weights2D", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterBlendSpace2DTest::RunTest(const FString& Parameters)
+{
+	TArray<FVector2D> Positions;
+	Positions.Add(FVector2D(0.f, 0.f));
+	Positions.Add(FVector2D(100.f, 0.f));
+	Positions.Add(FVector2D(0.f, 100.f));
+	Positions.Add(FVector2D(100.f, 100.f));
+	USpriterBlendSpace* BlendSpace = CreateBlendSpace(Positions, true);
+
+	TArray<FSpriterBlendSampleWeight> Weights;
+
+	BlendSpace->GetSampleWeights(FVector2D(50.f, 50.f), Weights);
+	TestEqual(TEXT("Samples in the middle of a square"), Weights.Num(), 4);
+	for (int32 SampleIndex = 0; SampleIndex < Positions.Num(); ++SampleIndex)
+	{
+		SpriterTestData::TestNearlyEqual(*this, TEXT("Middle of a square"), GetWeight(Weights, SampleIndex), 0.25f);
+	}
+
+	BlendSpace->GetSampleWeights(FVector2D(100.f, 0.f), Weights);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Exact on a corner"), GetWeight(Weights, 1), 1.f);
+
+	BlendSpace->GetSampleWeights(FVector2D(50.f, 0.f), Weights);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Along an edge"), GetWeight(Weights, 0) + GetWeight(Weights, 1), 1.f);
+
+	// A dense grid never blends more than MAX_BLENDED_SAMPLES, and the Weights stay normalized and sorted everywhere
+	Positions.Reset();
+	for (int32 Y = 0; Y < 4; ++Y)
+	{
+		for (int32 X = 0; X < 4; ++X)
+		{
+			Positions.Add(FVector2D(X * 100.f, Y * 100.f));
+		}
+	}
+	BlendSpace = CreateBlendSpace(Positions, true);
+
+	for (float Y = -50.f; Y <= 350.f; Y += 37.f)
+	{
+		for (float X = -50.f; X <= 350.f; X += 37.f)
+		{
+			BlendSpace->GetSampleWeights(FVector2D(X, Y), Weights);
+			TestTrue(TEXT("At most MAX_BLENDED_SAMPLES"), Weights.Num() > 0 && Weights.Num() <= USpriterBlendSpace::MAX_BLENDED_SAMPLES);
+
+			float TotalWeight = 0.f;
+			for (int32 WeightIndex = 0; WeightIndex < Weights.Num(); ++WeightIndex)
+			{
+				TotalWeight += Weights[WeightIndex].Weight;
+				TestTrue(TEXT("Heaviest first"), WeightIndex == 0 || Weights[WeightIndex - 1].Weight >= Weights[WeightIndex].Weight);
+			}
+			SpriterTestData::TestNearlyEqual(*this, FString::Printf(TEXT("Weights sum to 1 at (%f, %f)"), X, Y), TotalWeight, 1.f);
+		}
+	}
+
+	return true;
+}
+
+#endif
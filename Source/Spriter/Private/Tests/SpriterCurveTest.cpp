@@ -0,0 +1,108 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterTestData.h"
+#include "SpriterCurve.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterCurveEaseTest, "Spriter.Curve.Ease", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterCurveEaseTest::RunTest(const FString& Parameters)
+{
+	const float Tolerance = 1.e-3f;
+
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Linear"), FSpriterCurve::Ease(ESpriterCurveType::Linear, 0.f, 0.f, 0.f, 0.f, 0.3f), 0.3f, Tolerance);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Instant holds the First Key"), FSpriterCurve::Ease(ESpriterCurveType::Instant, 0.f, 0.f, 0.f, 0.f, 0.7f), 0.f, Tolerance);
+
+	// Control values spread evenly between 0 and 1 make every Curve linear
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Even Quadratic"), FSpriterCurve::Ease(ESpriterCurveType::Quadratic, 0.5f, 0.f, 0.f, 0.f, 0.25f), 0.25f, Tolerance);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Even Cubic"), FSpriterCurve::Ease(ESpriterCurveType::Cubic, 1.f / 3.f, 2.f / 3.f, 0.f, 0.f, 0.4f), 0.4f, Tolerance);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Even Quartic"), FSpriterCurve::Ease(ESpriterCurveType::Quartic, 0.25f, 0.5f, 0.75f, 0.f, 0.6f), 0.6f, Tolerance);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Even Quintic"), FSpriterCurve::Ease(ESpriterCurveType::Quintic, 0.2f, 0.4f, 0.6f, 0.8f, 0.8f), 0.8f, Tolerance);
+
+	// Spriter's nested lerps, worked out by hand
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Quadratic ease in"), FSpriterCurve::Ease(ESpriterCurveType::Quadratic, 0.f, 0.f, 0.f, 0.f, 0.5f), 0.25f, Tolerance);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Cubic ease in out"), FSpriterCurve::Ease(ESpriterCurveType::Cubic, 0.f, 1.f, 0.f, 0.f, 0.25f), 0.15625f, Tolerance);
+
+	// Every Curve starts on the First Key and ends on the Second
+	const ESpriterCurveType Curves[] = { ESpriterCurveType::Quadratic, ESpriterCurveType::Cubic, ESpriterCurveType::Quartic, ESpriterCurveType::Quintic, ESpriterCurveType::Bezier };
+	for (ESpriterCurveType CurveType : Curves)
+	{
+		SpriterTestData::TestNearlyEqual(*this, TEXT("Curve at 0"), FSpriterCurve::Ease(CurveType, 0.3f, 0.9f, 0.1f, 0.7f, 0.f), 0.f, Tolerance);
+		SpriterTestData::TestNearlyEqual(*this, TEXT("Curve at 1"), FSpriterCurve::Ease(CurveType, 0.3f, 0.9f, 0.1f, 0.7f, 1.f), 1.f, Tolerance);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterCurveBezierTest, "Spriter.Curve.Bezier", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterCurveBezierTest::RunTest(const FString& Parameters)
+{
+	const float Tolerance = 1.e-3f;
+
+	// Control points on the diagonal make the Bezier linear
+	for (float X = 0.f; X <= 1.f; X += 0.125f)
+	{
+		SpriterTestData::TestNearlyEqual(*this, FString::Printf(TEXT("Linear Bezier at %f"), X), FSpriterCurve::SolveBezier(0.25f, 0.25f, 0.75f, 0.75f, X), X, Tolerance);
+	}
+
+	// An ease in out Bezier is symmetric around its middle and never runs backwards
+	float PreviousY = 0.f;
+	for (float X = 0.f; X <= 1.f; X += 0.0625f)
+	{
+		const float Y = FSpriterCurve::SolveBezier(0.42f, 0.f, 0.58f, 1.f, X);
+		const float MirroredY = FSpriterCurve::SolveBezier(0.42f, 0.f, 0.58f, 1.f, 1.f - X);
+		SpriterTestData::TestNearlyEqual(*this, FString::Printf(TEXT("Symmetric Bezier at %f"), X), Y, 1.f - MirroredY, Tolerance);
+		TestTrue(FString::Printf(TEXT("Monotonic Bezier at %f"), X), Y >= PreviousY - Tolerance);
+		PreviousY = Y;
+	}
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Ease in out Bezier middle"), FSpriterCurve::SolveBezier(0.42f, 0.f, 0.58f, 1.f, 0.5f), 0.5f, Tolerance);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterCurveMainlineTest, "Spriter.Curve.MainlineTime", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterCurveMainlineTest::RunTest(const FString& Parameters)
+{
+	const float Tolerance = 1.e-2f;
+
+	USpriterImportData* Skeleton = SpriterTestData::CreateSkeleton();
+	FSpriterAnimation& Walk = Skeleton->ImportedData.Entities[0].Animations[0];
+
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Linear Mainline Key leaves time alone"), FSpriterCurve::EaseMainlineTime(Walk, 0, 250.f), 250.f, Tolerance);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Invalid Mainline Key leaves time alone"), FSpriterCurve::EaseMainlineTime(Walk, INDEX_NONE, 250.f), 250.f, Tolerance);
+
+	// The first Key eases towards the second (at 500ms), the last one towards the Animation's end (at 1000ms)
+	Walk.MainlineKeys[0].CurveType = ESpriterCurveType::Quadratic;
+	Walk.MainlineKeys[0].C1 = 0.f;
+	Walk.MainlineKeys[1].CurveType = ESpriterCurveType::Instant;
+
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Quadratic Mainline start"), FSpriterCurve::EaseMainlineTime(Walk, 0, 0.f), 0.f, Tolerance);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Quadratic Mainline middle"), FSpriterCurve::EaseMainlineTime(Walk, 0, 250.f), 125.f, Tolerance);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Quadratic Mainline end"), FSpriterCurve::EaseMainlineTime(Walk, 0, 500.f), 500.f, Tolerance);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Instant last Mainline Key"), FSpriterCurve::EaseMainlineTime(Walk, 1, 900.f), 500.f, Tolerance);
+
+	// The Timeline Curve only sees the eased time: Quadratic Mainline time 125ms is 0.25 of the way to the next root Key, eased again to 0.0625
+	Walk.Timelines[0].Keys[0].CurveType = ESpriterCurveType::Quadratic;
+	Walk.Timelines[0].Keys[0].C1 = 0.f;
+	Skeleton->BuildDerivedData();
+
+	SpriterTestData::FSkeletonWorld TestWorld(Skeleton);
+	TestWorld.Component->PlayAnimation(TEXT("Walk"), 0.f);
+	TestWorld.Tick(0.25f);
+	TestWorld.Tick(0.f);
+
+	const FSpriterBoneInstance* Root = TestWorld.Component->GetBone(TEXT("root"));
+	TestTrue(TEXT("Root Bone found"), Root != nullptr);
+	if (Root)
+	{
+		SpriterTestData::TestNearlyEqual(*this, TEXT("Root Bone with both Curves"), Root->WorldTransform2D.X, 50.f * 0.0625f, Tolerance);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterTestData.h"
+#include "PaperSpriteComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Helpers
+
+// Number of the Actor's Sprite Components that would draw something
+static int32 CountRenderedSpriteComponents(AActor* Actor)
+{
+	TArray<UPaperSpriteComponent*> SpriteComponents;
+	Actor->GetComponents(SpriteComponents);
+
+	int32 NumRendered = 0;
+	for (UPaperSpriteComponent* SpriteComponent : SpriteComponents)
+	{
+		if (SpriteComponent->IsVisible() && SpriteComponent->GetSprite())
+		{
+			++NumRendered;
+		}
+	}
+
+	return NumRendered;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterEntitySwitchTest, "Spriter.Skeleton.EntitySwitchHidesUnusedSprites", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterEntitySwitchTest::RunTest(const FString& Parameters)
+{
+	SpriterTestData::FSkeletonWorld TestWorld(SpriterTestData::CreateSkeleton());
+	USpriterSkeletonComponent* Component = TestWorld.Component;
+	AActor* Actor = Component->GetOwner();
+
+	Component->SetCharacterMap(SpriterTestData::CreateCharacterMap());
+	Component->PlayAnimation(TEXT("Walk"), 0.f);
+	TestWorld.Tick(0.1f);
+	TestEqual(TEXT("Character shows its body"), CountRenderedSpriteComponents(Actor), 1);
+
+	// The body's Sprite Component goes back to the Pool, and comes out again for one of the Prop's Sprites
+	Component->SetActiveEntityByName(TEXT("Prop"));
+	TestEqual(TEXT("Prop Sprites"), Component->Sprites.Num(), 2);
+
+	Component->PlayAnimation(TEXT("Open"), 0.f);
+	TestWorld.Tick(0.1f);
+	TestEqual(TEXT("Only the lid shows"), CountRenderedSpriteComponents(Actor), 1);
+
+	const FSpriterSpriteInstance* Shadow = Component->GetSprite(TEXT("shadow"));
+	TestTrue(TEXT("Shadow found"), Shadow != nullptr);
+	if (Shadow && Shadow->SpriteComponent)
+	{
+		TestFalse(TEXT("Shadow is never referenced, so it renders nothing"), Shadow->SpriteComponent->IsVisible() && Shadow->SpriteComponent->GetSprite() != nullptr);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterTestData.h"
+#include "SpriterTestEventListener.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterEventWindowTest, "Spriter.Skeleton.EventWindow", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterEventWindowTest::RunTest(const FString& Parameters)
+{
+	// "step" fires at 250ms, and again just before the Walk Loops
+	USpriterImportData* Skeleton = SpriterTestData::CreateSkeleton();
+	FSpriterEventLine& Step = Skeleton->ImportedData.Entities[0].Animations[0].EventLines[0];
+	Step.Keys.AddDefaulted();
+	Step.Keys[1].TimeInMS = 950;
+
+	SpriterTestData::FSkeletonWorld TestWorld(Skeleton);
+	USpriterSkeletonComponent* Component = TestWorld.Component;
+
+	USpriterTestEventListener* Listener = NewObject<USpriterTestEventListener>(TestWorld.World);
+	Listener->Listen(Component);
+	TArray<int32>& Fired = Listener->FiredTimesMS;
+
+	Component->PlayAnimation(TEXT("Walk"), 0.f);
+
+	TestWorld.Tick(0.2f);
+	TestWorld.Tick(0.f);
+	TestEqual(TEXT("Nothing fires before the first Key"), Fired.Num(), 0);
+
+	// No frame lands on 250ms, the Key still fires because it is within the window since the last Update
+	TestWorld.Tick(0.4f);
+	TestWorld.Tick(0.f);
+	TestEqual(TEXT("Key skipped over by a long frame"), Fired.Num(), 1);
+	TestEqual(TEXT("Time of the skipped over Key"), Fired.Num() > 0 ? Fired.Last() : INDEX_NONE, 250);
+
+	TestWorld.Tick(0.3f);
+	TestWorld.Tick(0.f);
+	TestEqual(TEXT("A Key fires only once"), Fired.Num(), 1);
+
+	// Reaching the end fires what is left of the window before the Loop restarts it
+	TestWorld.Tick(0.2f);
+	TestEqual(TEXT("Key between the last Update and the end"), Fired.Num(), 2);
+	TestEqual(TEXT("Time of the Key before the end"), Fired.Num() > 1 ? Fired.Last() : INDEX_NONE, 950);
+
+	TestWorld.Tick(0.3f);
+	TestWorld.Tick(0.f);
+	TestEqual(TEXT("Key fires again after the Loop"), Fired.Num(), 3);
+	TestEqual(TEXT("Time of the Key after the Loop"), Fired.Num() > 2 ? Fired.Last() : INDEX_NONE, 250);
+
+	// Seeking back fires nothing, even over a Key
+	Component->CurrentTimeMS = 100.f;
+	TestWorld.Tick(0.f);
+	TestEqual(TEXT("Seek back"), Fired.Num(), 3);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,100 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterTestData.h"
+#include "SpriterPlaybackCursor.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterPlaybackCursorFindKeyTest, "Spriter.PlaybackCursor.FindKey", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterPlaybackCursorFindKeyTest::RunTest(const FString& Parameters)
+{
+	// Keys every 100ms from 0 to 900
+	TArray<FSpriterFatTimelineKey> Keys;
+	for (int32 KeyIndex = 0; KeyIndex < 10; ++KeyIndex)
+	{
+		Keys.Add(SpriterTestData::MakeKey(KeyIndex * 100, 0.f, 0.f, 0.f));
+	}
+
+	int32 Cursor = INDEX_NONE;
+	TestEqual(TEXT("Before the first Key"), FSpriterPlaybackCursor::FindKey(Keys, -1.f, Cursor), (int32)INDEX_NONE);
+	TestEqual(TEXT("Cursor before the first Key"), Cursor, (int32)INDEX_NONE);
+
+	TestEqual(TEXT("On the first Key"), FSpriterPlaybackCursor::FindKey(Keys, 0.f, Cursor), 0);
+	TestEqual(TEXT("Just before the second Key"), FSpriterPlaybackCursor::FindKey(Keys, 99.9f, Cursor), 0);
+	TestEqual(TEXT("On the second Key"), FSpriterPlaybackCursor::FindKey(Keys, 100.f, Cursor), 1);
+	TestEqual(TEXT("Cursor follows the found Key"), Cursor, 1);
+
+	// Stepping forward within MAX_LINEAR_STEPS
+	TestEqual(TEXT("A few Keys ahead"), FSpriterPlaybackCursor::FindKey(Keys, 350.f, Cursor), 3);
+
+	// Further ahead than the Cursor steps, and back again like a Loop wrap
+	TestEqual(TEXT("Many Keys ahead"), FSpriterPlaybackCursor::FindKey(Keys, 950.f, Cursor), 9);
+	TestEqual(TEXT("Past the last Key"), FSpriterPlaybackCursor::FindKey(Keys, 5000.f, Cursor), 9);
+	TestEqual(TEXT("Back to the start"), FSpriterPlaybackCursor::FindKey(Keys, 50.f, Cursor), 0);
+
+	// A stale Cursor from another Animation is ignored
+	Cursor = 42;
+	TestEqual(TEXT("Out of range Cursor"), FSpriterPlaybackCursor::FindKey(Keys, 420.f, Cursor), 4);
+
+	// Whatever the Cursor, the result matches a search from scratch
+	for (int32 TimeMS = -50; TimeMS <= 1000; TimeMS += 25)
+	{
+		for (int32 Start = INDEX_NONE; Start < Keys.Num(); ++Start)
+		{
+			int32 SteppedCursor = Start;
+			int32 FreshCursor = INDEX_NONE;
+			const int32 Expected = FSpriterPlaybackCursor::FindKey(Keys, TimeMS, FreshCursor);
+			if (FSpriterPlaybackCursor::FindKey(Keys, TimeMS, SteppedCursor) != Expected)
+			{
+				AddError(FString::Printf(TEXT("Cursor at %d found another Key than a search at %dms"), Start, TimeMS));
+			}
+		}
+	}
+
+	TArray<FSpriterFatTimelineKey> NoKeys;
+	Cursor = INDEX_NONE;
+	TestEqual(TEXT("No Keys"), FSpriterPlaybackCursor::FindKey(NoKeys, 100.f, Cursor), (int32)INDEX_NONE);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterPlaybackCursorAlphaTest, "Spriter.PlaybackCursor.PlayingAlpha", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterPlaybackCursorAlphaTest::RunTest(const FString& Parameters)
+{
+	TestEqual(TEXT("On the First Key"), FSpriterPlaybackCursor::GetPlayingAlpha(0.f, 0, 500, 1000), 0.f);
+	TestEqual(TEXT("Halfway"), FSpriterPlaybackCursor::GetPlayingAlpha(250.f, 0, 500, 1000), 0.5f);
+	TestEqual(TEXT("Halfway, wrapping to the start"), FSpriterPlaybackCursor::GetPlayingAlpha(750.f, 500, 0, 1000), 0.5f);
+	TestEqual(TEXT("Single Key"), FSpriterPlaybackCursor::GetPlayingAlpha(300.f, 200, 200, 1000), 0.f);
+	TestEqual(TEXT("Last Key at the end"), FSpriterPlaybackCursor::GetPlayingAlpha(1000.f, 1000, 0, 1000), 0.f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterPlaybackCursorResetTest, "Spriter.PlaybackCursor.Reset", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterPlaybackCursorResetTest::RunTest(const FString& Parameters)
+{
+	USpriterImportData* Skeleton = SpriterTestData::CreateSkeleton();
+	const FSpriterEntity& Entity = Skeleton->ImportedData.Entities[0];
+
+	FSpriterPlaybackCursor Cursor;
+	Cursor.Reset(&Entity.Animations[0]);
+	TestEqual(TEXT("Timeline Cursors"), Cursor.TimelineKeys.Num(), Entity.Animations[0].Timelines.Num());
+	TestEqual(TEXT("Event Line Cursors"), Cursor.EventLineKeys.Num(), Entity.Animations[0].EventLines.Num());
+
+	Cursor.MainlineKey = 1;
+	Cursor.TimelineKeys[0] = 2;
+
+	Cursor.Reset(&Entity.Animations[1]);
+	TestTrue(TEXT("Points at the new Animation"), Cursor.Animation == &Entity.Animations[1]);
+	TestEqual(TEXT("Mainline Cursor forgotten"), Cursor.MainlineKey, (int32)INDEX_NONE);
+	TestEqual(TEXT("Timeline Cursors resized"), Cursor.TimelineKeys.Num(), Entity.Animations[1].Timelines.Num());
+	TestEqual(TEXT("Timeline Cursor forgotten"), Cursor.TimelineKeys[0], (int32)INDEX_NONE);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,139 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterTestData.h"
+#include "SpriterRootTrack.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Helpers
+
+static USpriterImportData* CreateSkeletonWithRootBone(const FString& RootBoneName)
+{
+	USpriterImportData* Skeleton = SpriterTestData::CreateSkeleton();
+	Skeleton->RootBoneName = RootBoneName;
+	Skeleton->BuildDerivedData();
+	return Skeleton;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterRootTrackDeltaTest, "Spriter.RootTrack.Delta", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterRootTrackDeltaTest::RunTest(const FString& Parameters)
+{
+	USpriterImportData* Skeleton = CreateSkeletonWithRootBone(TEXT("root"));
+	const FSpriterEntity& Entity = Skeleton->ImportedData.Entities[0];
+
+	const FSpriterRootTrack* Walk = Skeleton->GetRootTrack(&Entity.Animations[0]);
+	const FSpriterRootTrack* Idle = Skeleton->GetRootTrack(&Entity.Animations[1]);
+	TestTrue(TEXT("Root Tracks built"), Walk && Idle);
+	if (!Walk || !Idle)
+	{
+		return true;
+	}
+
+	FVector2D Translation;
+	float Rotation = 0.f;
+
+	Walk->GetDelta(0.f, 500.f, Translation, Rotation);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Walk first half X"), Translation.X, 50.f);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Walk first half Y"), Translation.Y, 0.f);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Walk first half Rotation"), Rotation, 0.f);
+
+	// Deltas are exact between Samples too, and across Mainline Keys
+	Walk->GetDelta(260.f, 740.f, Translation, Rotation);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Walk across Mainline Keys"), Translation.X, 48.f);
+
+	Walk->GetDelta(0.f, 1000.f, Translation, Rotation);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Whole Walk"), Translation.X, 100.f);
+
+	// Backwards is the negated delta
+	Walk->GetDelta(750.f, 250.f, Translation, Rotation);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Backwards Walk"), Translation.X, -50.f);
+
+	// Idle's last Key at 250ms interpolates back towards its first, wrapping around the end
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Idle peak"), Idle->Evaluate(250.f).Y, 20.f);
+	Idle->GetDelta(250.f, 375.f, Translation, Rotation);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Idle wrapping back"), Translation.Y, -10.f);
+
+	// Times outside the Animation are clamped to it
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Before the start"), Walk->Evaluate(-100.f).X, 0.f);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("After the end"), Walk->Evaluate(2000.f).X, 100.f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterRootTrackRotationTest, "Spriter.RootTrack.Rotation", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterRootTrackRotationTest::RunTest(const FString& Parameters)
+{
+	// The arm turns 90 degrees by 500ms, then on towards its first Key, counter clockwise like Spriter's default Spin
+	USpriterImportData* Skeleton = CreateSkeletonWithRootBone(TEXT("arm"));
+	FSpriterAnimation& WalkAnimation = Skeleton->ImportedData.Entities[0].Animations[0];
+	const FSpriterRootTrack* Walk = Skeleton->GetRootTrack(&WalkAnimation);
+	TestTrue(TEXT("Root Track built"), Walk != nullptr);
+	if (!Walk)
+	{
+		return true;
+	}
+
+	FVector2D Translation;
+	float Rotation = 0.f;
+
+	Walk->GetDelta(0.f, 250.f, Translation, Rotation);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Quarter Rotation"), Rotation, 45.f);
+
+	Walk->GetDelta(500.f, 750.f, Translation, Rotation);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Turning on"), Rotation, 135.f);
+
+	Walk->GetDelta(0.f, 1000.f, Translation, Rotation);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Full turn"), Rotation, 360.f);
+
+	// Spinning clockwise turns back instead
+	WalkAnimation.Timelines[1].Keys[1].Spin = -1;
+	Skeleton->BuildDerivedData();
+	Walk = Skeleton->GetRootTrack(&WalkAnimation);
+
+	Walk->GetDelta(500.f, 750.f, Translation, Rotation);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Turning back"), Rotation, -45.f);
+
+	// Idle doesnt animate the arm, and a Bone no Animation has builds no Tracks
+	TestTrue(TEXT("No Root Track without the Bone"), Skeleton->GetRootTrack(&Skeleton->ImportedData.Entities[0].Animations[1]) == nullptr);
+
+	USpriterImportData* Tailless = CreateSkeletonWithRootBone(TEXT("tail"));
+	TestTrue(TEXT("No Root Track for a missing Bone"), Tailless->GetRootTrack(&Tailless->ImportedData.Entities[0].Animations[0]) == nullptr);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterRootMotionTest, "Spriter.Skeleton.RootMotion", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterRootMotionTest::RunTest(const FString& Parameters)
+{
+	SpriterTestData::FSkeletonWorld TestWorld(CreateSkeletonWithRootBone(TEXT("root")));
+	USpriterSkeletonComponent* Component = TestWorld.Component;
+	Component->bExtractRootMotion = true;
+	Component->PlayAnimation(TEXT("Walk"), 0.f);
+
+	// Every Tick hands out the motion of the time it advanced over
+	TestWorld.Tick(0.25f);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Root Motion of the first Tick"), Component->RootMotionTranslation.X, 25.f);
+
+	TestWorld.Tick(0.5f);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("Root Motion of the second Tick"), Component->RootMotionTranslation.X, 50.f);
+
+	// The motion is taken out of the Pose, the root Bone stays where the Animation starts
+	TestWorld.Tick(0.f);
+	SpriterTestData::TestNearlyEqual(*this, TEXT("No Root Motion without time"), Component->RootMotionTranslation.X, 0.f);
+
+	const FSpriterBoneInstance* Root = Component->GetBone(TEXT("root"));
+	TestTrue(TEXT("Root Bone found"), Root != nullptr);
+	if (Root)
+	{
+		SpriterTestData::TestNearlyEqual(*this, TEXT("Root Bone held at the start"), Root->WorldTransform2D.X, 0.f);
+	}
+
+	return true;
+}
+
+#endif
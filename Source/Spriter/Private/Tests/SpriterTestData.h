@@ -0,0 +1,225 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SpriterImportData.h"
+#include "SpriterSkeletonComponent.h"
+
+// Builds small Skeletons in code, so the Automation Tests dont depend on imported assets
+namespace SpriterTestData
+{
+	// Adds an error to Test when Actual isnt within Tolerance of Expected
+	inline void TestNearlyEqual(FAutomationTestBase& Test, const FString& What, float Actual, float Expected, float Tolerance = 1.e-3f)
+	{
+		if (!FMath::IsNearlyEqual(Actual, Expected, Tolerance))
+		{
+			Test.AddError(FString::Printf(TEXT("%s: expected %f, but it was %f"), *What, Expected, Actual));
+		}
+	}
+
+	inline FSpriterFatTimelineKey MakeKey(int32 TimeMS, float X, float Y, float Angle, ESpriterCurveType CurveType = ESpriterCurveType::Linear)
+	{
+		FSpriterFatTimelineKey Key;
+		Key.TimeInMS = TimeMS;
+		Key.CurveType = CurveType;
+		Key.Info.X = X;
+		Key.Info.Y = Y;
+		Key.Info.AngleInDegrees = Angle;
+		return Key;
+	}
+
+	inline FSpriterTimeline MakeTimeline(const FString& Name, ESpriterObjectType ObjectType, int32 ObjectInfoIndex)
+	{
+		FSpriterTimeline Timeline;
+		Timeline.Name = Name;
+		Timeline.ObjectType = ObjectType;
+		Timeline.ObjectInfoIndex = ObjectInfoIndex;
+		return Timeline;
+	}
+
+	inline FSpriterRef MakeBoneRef(int32 ParentTimelineIndex, int32 TimelineIndex, int32 KeyIndex)
+	{
+		FSpriterRef Ref;
+		Ref.ParentTimelineIndex = ParentTimelineIndex;
+		Ref.TimelineIndex = TimelineIndex;
+		Ref.KeyIndex = KeyIndex;
+		return Ref;
+	}
+
+	inline FSpriterObjectRef MakeObjectRef(int32 ParentTimelineIndex, int32 TimelineIndex, int32 KeyIndex, int32 ZIndex)
+	{
+		FSpriterObjectRef Ref;
+		Ref.ParentTimelineIndex = ParentTimelineIndex;
+		Ref.TimelineIndex = TimelineIndex;
+		Ref.KeyIndex = KeyIndex;
+		Ref.ZIndex = ZIndex;
+		return Ref;
+	}
+
+	inline FSpriterObjectInfo MakeObjectInfo(const FString& Name, ESpriterObjectType ObjectType)
+	{
+		FSpriterObjectInfo Info;
+		Info.Name = Name;
+		Info.ObjectType = ObjectType;
+		return Info;
+	}
+
+	// A looping 1000ms "Walk" moving a "root" Bone from 0 to 100 along X and rotating its "arm" child Bone, with a static "body" Sprite,
+	// a "hand" Point on the arm and a "step" Event at 250ms, plus a 500ms "Idle" that only animates the root Bone.
+	// A second "Prop" Entity plays "Open", showing a "lid" Sprite while its "shadow" Sprite is never referenced
+	inline USpriterImportData* CreateSkeleton()
+	{
+		USpriterImportData* Skeleton = NewObject<USpriterImportData>(GetTransientPackage());
+		Skeleton->PixelsPerUnrealUnit = 1.f;
+
+		FSpriterFolder& Folder = Skeleton->ImportedData.Folders[Skeleton->ImportedData.Folders.AddDefaulted()];
+		FSpriterFile& File = Folder.Files[Folder.Files.AddDefaulted()];
+		File.Name = TEXT("body.png");
+		File.FileType = ESpriterFileType::Sprite;
+		File.Width = 32;
+		File.Height = 32;
+
+		FSpriterEntity& Entity = Skeleton->ImportedData.Entities[Skeleton->ImportedData.Entities.AddDefaulted()];
+		Entity.Name = TEXT("Character");
+		Entity.Objects.Add(MakeObjectInfo(TEXT("root"), ESpriterObjectType::Bone));
+		Entity.Objects.Add(MakeObjectInfo(TEXT("arm"), ESpriterObjectType::Bone));
+		Entity.Objects.Add(MakeObjectInfo(TEXT("step"), ESpriterObjectType::Event));
+
+		FSpriterAnimation& Walk = Entity.Animations[Entity.Animations.AddDefaulted()];
+		Walk.Name = TEXT("Walk");
+		Walk.LengthInMS = 1000;
+		Walk.bIsLooping = true;
+
+		FSpriterTimeline& Root = Walk.Timelines[Walk.Timelines.Add(MakeTimeline(TEXT("root"), ESpriterObjectType::Bone, 0))];
+		Root.Keys.Add(MakeKey(0, 0.f, 0.f, 0.f));
+		Root.Keys.Add(MakeKey(500, 50.f, 0.f, 0.f));
+		Root.Keys.Add(MakeKey(1000, 100.f, 0.f, 0.f));
+
+		FSpriterTimeline& Arm = Walk.Timelines[Walk.Timelines.Add(MakeTimeline(TEXT("arm"), ESpriterObjectType::Bone, 1))];
+		Arm.Keys.Add(MakeKey(0, 10.f, 0.f, 0.f));
+		Arm.Keys.Add(MakeKey(500, 10.f, 0.f, 90.f));
+
+		FSpriterTimeline& Body = Walk.Timelines[Walk.Timelines.Add(MakeTimeline(TEXT("body"), ESpriterObjectType::Sprite, INDEX_NONE))];
+		FSpriterFatTimelineKey& BodyKey = Body.Keys[Body.Keys.Add(MakeKey(0, 0.f, 0.f, 0.f))];
+		BodyKey.FolderIndex = 0;
+		BodyKey.FileIndex = 0;
+
+		FSpriterTimeline& Hand = Walk.Timelines[Walk.Timelines.Add(MakeTimeline(TEXT("hand"), ESpriterObjectType::Point, INDEX_NONE))];
+		Hand.Keys.Add(MakeKey(0, 5.f, 0.f, 0.f));
+		Hand.Keys.Add(MakeKey(500, 10.f, 0.f, 0.f));
+
+		// Mainline Keys only reference the first two Root Keys, the last one is what the second interpolates towards
+		for (int32 KeyIndex = 0; KeyIndex < 2; ++KeyIndex)
+		{
+			FSpriterMainlineKey& MainlineKey = Walk.MainlineKeys[Walk.MainlineKeys.AddDefaulted()];
+			MainlineKey.TimeInMS = KeyIndex * 500;
+			MainlineKey.CurveType = ESpriterCurveType::Linear;
+			MainlineKey.BoneRefs.Add(MakeBoneRef(INDEX_NONE, 0, KeyIndex));
+			MainlineKey.BoneRefs.Add(MakeBoneRef(0, 1, KeyIndex));
+			MainlineKey.ObjectRefs.Add(MakeObjectRef(INDEX_NONE, 2, 0, 0));
+			MainlineKey.ObjectRefs.Add(MakeObjectRef(1, 3, KeyIndex, 1));
+		}
+
+		FSpriterEventLine& Step = Walk.EventLines[Walk.EventLines.AddDefaulted()];
+		Step.Name = TEXT("step");
+		Step.ObjectIndex = 2;
+		Step.Keys.AddDefaulted();
+		Step.Keys[0].TimeInMS = 250;
+
+		FSpriterAnimation& Idle = Entity.Animations[Entity.Animations.AddDefaulted()];
+		Idle.Name = TEXT("Idle");
+		Idle.LengthInMS = 500;
+		Idle.bIsLooping = true;
+
+		FSpriterTimeline& IdleRoot = Idle.Timelines[Idle.Timelines.Add(MakeTimeline(TEXT("root"), ESpriterObjectType::Bone, 0))];
+		IdleRoot.Keys.Add(MakeKey(0, 0.f, 0.f, 0.f));
+		IdleRoot.Keys.Add(MakeKey(250, 0.f, 20.f, 0.f));
+
+		for (int32 KeyIndex = 0; KeyIndex < 2; ++KeyIndex)
+		{
+			FSpriterMainlineKey& MainlineKey = Idle.MainlineKeys[Idle.MainlineKeys.AddDefaulted()];
+			MainlineKey.TimeInMS = KeyIndex * 250;
+			MainlineKey.CurveType = ESpriterCurveType::Linear;
+			MainlineKey.BoneRefs.Add(MakeBoneRef(INDEX_NONE, 0, KeyIndex));
+		}
+
+		FSpriterEntity& Prop = Skeleton->ImportedData.Entities[Skeleton->ImportedData.Entities.AddDefaulted()];
+		Prop.Name = TEXT("Prop");
+
+		FSpriterAnimation& Open = Prop.Animations[Prop.Animations.AddDefaulted()];
+		Open.Name = TEXT("Open");
+		Open.LengthInMS = 500;
+		Open.bIsLooping = true;
+
+		const TCHAR* PropSprites[] = { TEXT("lid"), TEXT("shadow") };
+		for (const TCHAR* SpriteName : PropSprites)
+		{
+			FSpriterTimeline& Timeline = Open.Timelines[Open.Timelines.Add(MakeTimeline(SpriteName, ESpriterObjectType::Sprite, INDEX_NONE))];
+			FSpriterFatTimelineKey& Key = Timeline.Keys[Timeline.Keys.Add(MakeKey(0, 0.f, 0.f, 0.f))];
+			Key.FolderIndex = 0;
+			Key.FileIndex = 0;
+		}
+
+		FSpriterMainlineKey& OpenKey = Open.MainlineKeys[Open.MainlineKeys.AddDefaulted()];
+		OpenKey.TimeInMS = 0;
+		OpenKey.CurveType = ESpriterCurveType::Linear;
+		OpenKey.ObjectRefs.Add(MakeObjectRef(INDEX_NONE, 0, 0, 0));
+
+		Skeleton->BuildDerivedData();
+		return Skeleton;
+	}
+
+	// A Character Map showing a blank Sprite for "body.png"
+	inline USpriterCharacterMap* CreateCharacterMap()
+	{
+		USpriterCharacterMap* CharacterMap = NewObject<USpriterCharacterMap>(GetTransientPackage());
+
+		FSpriterCharacterMapEntry Entry;
+		Entry.AssociatedSprite = TEXT("body");
+		Entry.ResultSprite = NewObject<UPaperSprite>(GetTransientPackage());
+		CharacterMap->Entrys.Add(Entry);
+
+		return CharacterMap;
+	}
+
+	// A Game World with a single Actor owning a registered Skeleton Component, torn down when it goes out of scope
+	struct FSkeletonWorld
+	{
+		UWorld* World;
+
+		USpriterSkeletonComponent* Component;
+
+		FSkeletonWorld(USpriterImportData* Skeleton, bool bBatchSprites = false)
+		{
+			World = UWorld::CreateWorld(EWorldType::Game, false);
+			FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+			WorldContext.SetCurrentWorld(World);
+
+			AActor* Actor = World->SpawnActor<AActor>();
+			Component = NewObject<USpriterSkeletonComponent>(Actor);
+
+			// Nothing renders in a test World, so the Update LOD would stop evaluating
+			Component->bEnableUpdateLOD = false;
+			Component->bBatchSprites = bBatchSprites;
+
+			Actor->SetRootComponent(Component);
+			Component->RegisterComponent();
+			Component->SetSkeleton(Skeleton);
+		}
+
+		~FSkeletonWorld()
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+
+		// Every Tick evaluates at the current time and then advances it, a DeltaTime of 0 evaluates where the last Tick left off
+		void Tick(float DeltaTime, int32 NumTicks = 1)
+		{
+			for (int32 TickIndex = 0; TickIndex < NumTicks; ++TickIndex)
+			{
+				Component->TickComponent(DeltaTime, LEVELTICK_All, nullptr);
+			}
+		}
+	};
+}
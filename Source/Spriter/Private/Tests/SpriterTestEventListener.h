@@ -0,0 +1,31 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SpriterSkeletonComponent.h"
+#include "SpriterTestEventListener.generated.h"
+
+// Records every Event a Skeleton fires, for the Automation Tests. Dynamic delegates can only call UFUNCTIONs
+UCLASS(Transient)
+class USpriterTestEventListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	// Key time of every Event fired so far, in firing order
+	TArray<int32> FiredTimesMS;
+
+	void Listen(USpriterSkeletonComponent* Skeleton)
+	{
+		Skeleton->OnEvent.AddDynamic(this, &USpriterTestEventListener::HandleEvent);
+	}
+
+	UFUNCTION()
+		void HandleEvent(USpriterSkeletonComponent* Skeleton, const FString& EventName)
+	{
+		// The Skeleton stores the Key's time before it broadcasts
+		const FSpriterEventInstance* Event = Skeleton->Events.FindByPredicate([&EventName](const FSpriterEventInstance& Candidate) { return Candidate.Name == EventName; });
+		FiredTimesMS.Add(Event ? Event->PreviousCallTimeMS : INDEX_NONE);
+	}
+};
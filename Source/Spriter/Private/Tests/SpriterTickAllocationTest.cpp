@@ -0,0 +1,162 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpriterPrivatePCH.h"
+#include "SpriterTestData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Forwards to the real Allocator, counting the Allocations made on the Game Thread while armed
+class FSpriterAllocationCounter : public FMalloc
+{
+public:
+
+	FSpriterAllocationCounter(FMalloc* InInnerMalloc)
+		: InnerMalloc(InInnerMalloc)
+		, bArmed(false)
+		, NumAllocations(0)
+	{
+	}
+
+	void Arm()
+	{
+		NumAllocations = 0;
+		bArmed = true;
+	}
+
+	int32 Disarm()
+	{
+		bArmed = false;
+		return NumAllocations;
+	}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		CountAllocation();
+		return InnerMalloc->Malloc(Count, Alignment);
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0)
+		{
+			CountAllocation();
+		}
+		return InnerMalloc->Realloc(Original, Count, Alignment);
+	}
+
+	virtual void Free(void* Original) override
+	{
+		InnerMalloc->Free(Original);
+	}
+
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+	{
+		return InnerMalloc->QuantizeSize(Count, Alignment);
+	}
+
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+	{
+		return InnerMalloc->GetAllocationSize(Original, SizeOut);
+	}
+
+	virtual void Trim() override
+	{
+		InnerMalloc->Trim();
+	}
+
+	virtual bool IsInternallyThreadSafe() const override
+	{
+		return InnerMalloc->IsInternallyThreadSafe();
+	}
+
+	virtual bool ValidateHeap() override
+	{
+		return InnerMalloc->ValidateHeap();
+	}
+
+	virtual const TCHAR* GetDescriptiveName() override
+	{
+		return InnerMalloc->GetDescriptiveName();
+	}
+
+private:
+
+	void CountAllocation()
+	{
+		if (bArmed && IsInGameThread())
+		{
+			FPlatformAtomics::InterlockedIncrement(&NumAllocations);
+		}
+	}
+
+	FMalloc* InnerMalloc;
+
+	volatile bool bArmed;
+
+	volatile int32 NumAllocations;
+};
+
+// Counts the Allocations of 90 Ticks, after warming up past a Loop so every Key Pair, Event and Sprite has been seen once
+static int32 CountTickAllocations(SpriterTestData::FSkeletonWorld& TestWorld)
+{
+	const float DeltaTime = 1.f / 30.f;
+	TestWorld.Tick(DeltaTime, 40);
+
+	// Other threads may still be calling through the Counter after it is swapped out, so it outlives the test
+	static FSpriterAllocationCounter Counter(GMalloc);
+	FMalloc* PreviousMalloc = GMalloc;
+	GMalloc = &Counter;
+
+	Counter.Arm();
+	TestWorld.Tick(DeltaTime, 90);
+	const int32 NumAllocations = Counter.Disarm();
+
+	GMalloc = PreviousMalloc;
+
+	return NumAllocations;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterTickAllocationTest, "Spriter.Skeleton.TickDoesNotAllocate", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterTickAllocationTest::RunTest(const FString& Parameters)
+{
+	SpriterTestData::FSkeletonWorld TestWorld(SpriterTestData::CreateSkeleton());
+	USpriterSkeletonComponent* Component = TestWorld.Component;
+
+	// The Sprite never moves, so after its first push only the Animation code runs, which is what this covers, not Engine render state updates
+	Component->PlayAnimation(TEXT("Walk"), 0.f);
+
+	const int32 NumAllocations = CountTickAllocations(TestWorld);
+	TestEqual(TEXT("Bones after warm up"), Component->Bones.Num(), 2);
+	TestEqual(TEXT("Sprites after warm up"), Component->Sprites.Num(), 1);
+	TestEqual(TEXT("Allocations while ticking"), NumAllocations, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpriterBatchedTickAllocationTest, "Spriter.Skeleton.BatchedTickDoesNotAllocate", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSpriterBatchedTickAllocationTest::RunTest(const FString& Parameters)
+{
+	// Hanging the Body from the rotating Arm moves it every Tick, so the batch is built and handed to the Render Component every Tick
+	USpriterImportData* Skeleton = SpriterTestData::CreateSkeleton();
+	for (FSpriterMainlineKey& MainlineKey : Skeleton->ImportedData.Entities[0].Animations[0].MainlineKeys)
+	{
+		MainlineKey.ObjectRefs[0].ParentTimelineIndex = 1;
+	}
+	Skeleton->BuildDerivedData();
+
+	SpriterTestData::FSkeletonWorld TestWorld(Skeleton, true);
+	USpriterSkeletonComponent* Component = TestWorld.Component;
+	Component->SetCharacterMap(SpriterTestData::CreateCharacterMap());
+	Component->PlayAnimation(TEXT("Walk"), 0.f);
+
+	const int32 NumAllocations = CountTickAllocations(TestWorld);
+	TestNotNull(TEXT("Render Component"), Component->RenderComponent);
+	TestEqual(TEXT("Sprites after warm up"), Component->Sprites.Num(), 1);
+	TestEqual(TEXT("Allocations while ticking"), NumAllocations, 0);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+class USpriterSkeletonComponent;
+class FSpriterAnimationManager;
+
+// Tick Function the Manager registers once for every Tick Group its Skeletons use
+struct FSpriterManagerTickFunction : public FTickFunction
+{
+	FSpriterAnimationManager* Manager;
+
+	FSpriterManagerTickFunction();
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+
+	virtual FString DiagnosticMessage() override;
+};
+
+// Updates every registered Skeleton of a World in one batched pass per Tick Group, instead of one Tick Function per Component.
+// Within a group Skeletons are ordered by Priority, then by Import Data and Animation, so Skeletons sharing Keys update back to back.
+// The order is only refreshed when a Skeleton registers, so changing its Tick Group or Priority registers it again (see SetAnimationManager).
+// Inactive Skeletons are skipped, Skeletons with bParallelEvaluation are spread over worker threads.
+class SPRITER_API FSpriterAnimationManager
+{
+public:
+
+	// Returns the Manager of a World, creating it the first time
+	static FSpriterAnimationManager& Get(UWorld* World);
+
+	// Returns the Manager of a World, or nullptr if it has none
+	static FSpriterAnimationManager* Find(UWorld* World);
+
+	// Hooks up World cleanup, called by the Module
+	static void Startup();
+
+	static void Shutdown();
+
+	~FSpriterAnimationManager();
+
+	// Adds a Skeleton to the group of its AnimationTickGroup, the Skeleton should no longer tick itself
+	void Register(USpriterSkeletonComponent* Component);
+
+	void Unregister(USpriterSkeletonComponent* Component);
+
+	// Evaluates, applies and advances every Skeleton of a Tick Group
+	void TickGroup(ETickingGroup TickGroup, float DeltaTime);
+
+private:
+
+	struct FGroup
+	{
+		FSpriterManagerTickFunction TickFunction;
+
+		TArray<USpriterSkeletonComponent*> Components;
+
+		// Set when a Skeleton registers, so Components are sorted once before the next update instead of every frame
+		bool bNeedsSort;
+
+		// Skeletons being updated this frame, kept around so ticking doesnt allocate
+		TArray<USpriterSkeletonComponent*> Batch;
+
+		// The part of Batch evaluated on worker threads
+		TArray<USpriterSkeletonComponent*> ParallelBatch;
+
+		FGroup();
+	};
+
+	// DeltaTime scaled by the Time Dilation of the Skeleton's Owner, like its own Tick Function would get
+	static float GetComponentDeltaTime(const USpriterSkeletonComponent* Component, float DeltaTime);
+
+	FSpriterAnimationManager(UWorld* InWorld);
+
+	static void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	UWorld* World;
+
+	// Groups by Tick Group, created when the first Skeleton of a Tick Group registers
+	FGroup* Groups[TG_MAX];
+
+	// Every World's Manager
+	static TMap<UWorld*, FSpriterAnimationManager*> Managers;
+
+	static FDelegateHandle OnWorldCleanupHandle;
+};
@@ -0,0 +1,127 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SpriterPose.h"
+
+namespace ESpriterBakedChannel
+{
+	// Channels every Timeline of a Baked Animation has a Track for
+	enum Type
+	{
+		X,
+		Y,
+		Angle,
+		ScaleX,
+		ScaleY,
+		R,
+		G,
+		B,
+		A,
+
+		Count
+	};
+}
+
+// Every channel of one Timeline. Constant channels are resolved at Bake time and only keep their value,
+// the others are quantized to 16 bits over their own range and packed together, one row per Sample
+struct SPRITER_API FSpriterBakedTimeline
+{
+public:
+
+	// Value of every channel at a quantized 0, the whole value of constant channels
+	float Min[ESpriterBakedChannel::Count];
+
+	// Value of one quantized step of every packed channel, in packed order
+	float PackedSteps[ESpriterBakedChannel::Count];
+
+	// Channel of every packed channel, in packed order
+	uint8 PackedChannels[ESpriterBakedChannel::Count];
+
+	// Number of channels that arent constant, which is also the length of a row
+	int32 NumPacked;
+
+	// Where the Timeline's rows start in the quantized data
+	int32 Offset;
+
+	FSpriterBakedTimeline();
+
+	// Decodes every channel between a Sample's row and the next one, in one pass over the packed channels
+	FORCEINLINE void Decode(const uint16* Data, int32 SampleIndex, float Alpha, float* OutValues) const
+	{
+		FMemory::Memcpy(OutValues, Min, sizeof(Min));
+
+		const uint16* First = Data + Offset + (SampleIndex * NumPacked);
+		const uint16* Second = First + NumPacked;
+		for (int32 PackedIndex = 0; PackedIndex < NumPacked; ++PackedIndex)
+		{
+			const float FirstValue = First[PackedIndex];
+			const float SecondValue = Second[PackedIndex];
+			OutValues[PackedChannels[PackedIndex]] += PackedSteps[PackedIndex] * (FirstValue + ((SecondValue - FirstValue) * Alpha));
+		}
+	}
+
+	friend SPRITER_API FArchive& operator<<(FArchive& Ar, FSpriterBakedTimeline& Timeline);
+};
+
+// An Animation sampled at a fixed rate, so playing it back is two row reads and a lerp instead of a Key search.
+// Samples are stored compressed: constant channels keep a single value and all others are quantized to 16 bits.
+// The Bake comes on top of the Animation's Keys rather than replacing them, Baked playback still reads a Key's File and Pivot,
+// and Blends, Layers and the Editor evaluate the Keys. Animations with more Keys than a uint16 indexes arent Baked.
+struct SPRITER_API FSpriterBakedAnimation
+{
+public:
+
+	// Value stored for a Sample without a Key
+	static const uint16 NO_KEY = MAX_uint16;
+
+	// Samples per second
+	float SampleRate;
+
+	int32 NumSamples;
+
+	int32 NumTimelines;
+
+	int32 LengthInMS;
+
+	// Mainline Key in effect at each Sample
+	TArray<uint16> MainlineKeys;
+
+	// Timeline Key in effect at each Sample, stored as [TimelineIndex * NumSamples + SampleIndex]
+	TArray<uint16> TimelineKeys;
+
+	// Channels of every Timeline
+	TArray<FSpriterBakedTimeline> Timelines;
+
+	// Quantized rows of every Timeline, stored as [Timeline.Offset + SampleIndex * Timeline.NumPacked + PackedIndex]
+	TArray<uint16> QuantizedData;
+
+	FSpriterBakedAnimation();
+
+	// Samples the Animation with the Keyframe evaluator, which stays the reference for what Baked playback should look like
+	void Bake(FSpriterAnimation& Animation, float InSampleRate);
+
+	// Finds the Sample before TimeMS and how far towards the next Sample TimeMS is
+	void GetSample(float TimeMS, int32& OutSampleIndex, float& OutAlpha) const;
+
+	// Returns the Mainline Key in effect at a Sample, or INDEX_NONE
+	int32 GetMainlineKey(int32 SampleIndex) const;
+
+	// Decodes a Timeline between two neighbouring Samples, returns false if the Timeline has no Key there
+	bool SampleTimeline(int32 TimelineIndex, int32 SampleIndex, float Alpha, FSpriterTransform2D& OutTransform, FLinearColor& OutColor, int32& OutKey) const;
+
+	// Bytes used by the Baked data
+	SIZE_T GetAllocatedSize() const;
+
+	friend SPRITER_API FArchive& operator<<(FArchive& Ar, FSpriterBakedAnimation& Baked);
+
+	FORCEINLINE bool IsValid() const
+	{
+		return NumSamples > 1;
+	}
+
+	FORCEINLINE float GetSampleTimeMS(int32 SampleIndex) const
+	{
+		return FMath::Min<float>(LengthInMS, (SampleIndex * 1000.f) / SampleRate);
+	}
+};
@@ -0,0 +1,66 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SpriterBlendSpace.generated.h"
+
+USTRUCT(BlueprintType)
+struct SPRITER_API FSpriterBlendSample
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+
+	// Name of an Animation of the Entity the Blend Space is played on
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		FString AnimationName;
+
+	// Where the Animation sits in the Blend Space, Y is ignored by 1D Blend Spaces
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		FVector2D Position;
+
+	FSpriterBlendSample();
+};
+
+USTRUCT(BlueprintType)
+struct SPRITER_API FSpriterBlendSampleWeight
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+
+	UPROPERTY(BlueprintReadOnly, Category = "Spriter")
+		int32 SampleIndex;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Spriter")
+		float Weight;
+
+	FSpriterBlendSampleWeight();
+
+	FSpriterBlendSampleWeight(int32 InSampleIndex, float InWeight);
+};
+
+// Animations of one Entity placed along one or two parameters (like speed and direction), played as a single weighted Pose
+UCLASS(BlueprintType)
+class SPRITER_API USpriterBlendSpace : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	// Most Samples blended at once, the lightest ones are dropped
+	static const int32 MAX_BLENDED_SAMPLES = 4;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		TArray<FSpriterBlendSample> Samples;
+
+	// Blends over X and Y, otherwise only over X
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		bool bIs2D;
+
+	USpriterBlendSpace();
+
+	// Writes the Weight of every Sample contributing at Input, heaviest first and summing to 1
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void GetSampleWeights(const FVector2D& Input, TArray<FSpriterBlendSampleWeight>& OutWeights) const;
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "PaperSprite.h"
+#include "SpriterDataModel.h"
 #include "SpriterCharacterMap.generated.h"
 
 USTRUCT(BlueprintType)
@@ -28,4 +29,26 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 	TArray<FSpriterCharacterMapEntry> Entrys;
+
+	USpriterCharacterMap();
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// Needs to be called after changing Entrys, so every Skeleton and Crowd using the Map resolves its Sprites again
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+	void MarkEntrysChanged();
+
+	// Bumped whenever Entrys change, resolved Sprite tables remember it to know when they're stale
+	FORCEINLINE int32 GetChangeCount() const { return ChangeCount; }
+
+	// Returns the Sprite of the Entry associated with a File's Name (without its Folder or Extension), or nullptr
+	UPaperSprite* FindSprite(const FSpriterFile& File) const;
+
+	// Resolves every File of the Data to its Sprite once, OutSprites is indexed by FSpriterFile::TableIndex
+	void ResolveSprites(const FSpriterSCON& Data, int32 NumFiles, TArray<UPaperSprite*>& OutSprites) const;
+
+private:
+	int32 ChangeCount;
 };
\ No newline at end of file
@@ -0,0 +1,163 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SpriterRenderComponent.h"
+#include "SpriterImportData.h"
+#include "SpriterCharacterMap.h"
+#include "SpriterCrowdComponent.generated.h"
+
+// One member of a Crowd, plain data without any UObjects of its own
+USTRUCT(BlueprintType)
+struct SPRITER_API FSpriterCrowdInstance
+{
+	GENERATED_USTRUCT_BODY()
+
+	// Location relative to the Crowd Component
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		FVector Location;
+
+	// Angle (in degrees) in the Sprite plane, counter clockwise
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		float Angle;
+
+	// Scale in the Sprite plane, a negative X flips the Instance
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		FVector2D Scale;
+
+	// Index of the Animation in the Crowd's Entity
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		int32 AnimationIndex;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		float TimeMS;
+
+	// Speed the Animation plays at, 1 is normal speed
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		float PlayRate;
+
+	// Baked Sample and Animation the Instance was last drawn at, INDEX_NONE before it was drawn
+	int32 BuiltSampleIndex;
+
+	int32 BuiltAnimationIndex;
+
+	// Draw Calls the Instance was last built into, kept as they are while it stays at the same Sample
+	int32 BuiltFirstDrawCall;
+
+	int32 BuiltNumDrawCalls;
+
+	FSpriterCrowdInstance();
+};
+
+// Plays many copies of one Spriter Entity, all drawn from a single Render Component.
+// Instances are sampled from Baked Animations, so the Crowd never allocates per Instance and never creates Sprite Components.
+UCLASS( ClassGroup=(Spriter), meta=(BlueprintSpawnableComponent))
+class SPRITER_API USpriterCrowdComponent : public USpriterRenderComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spriter")
+		USpriterImportData* Skeleton;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spriter")
+		USpriterCharacterMap* CharacterMap;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spriter")
+		int32 EntityIndex;
+
+	// Samples per second Animations are Baked at, when the Skeleton itself has no Baked Animations
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spriter", meta = (ClampMin = "1"))
+		float FallbackBakeSampleRate;
+
+	// Instances are drawn in this order, call MarkInstancesDirty after moving them without the Instance functions
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		TArray<FSpriterCrowdInstance> Instances;
+
+	USpriterCrowdComponent();
+
+	// Advances every Instance, and rebuilds the vertices of the Instances that reached another Baked Sample
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// Rebuilds the Crowd's vertices on the next Tick, even if no Instance reached another Sample
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void MarkInstancesDirty();
+
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void SetSkeleton(USpriterImportData* NewSkeleton, int32 NewEntityIndex);
+
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void SetCharacterMap(USpriterCharacterMap* Map);
+
+	// Adds an Instance and returns its index
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		int32 AddInstance(const FVector& Location, int32 AnimationIndex, float TimeMS = 0.f, float PlayRate = 1.f);
+
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void RemoveInstance(int32 InstanceIndex);
+
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void ClearInstances();
+
+	// Plays an Animation (by index in the Entity) on an Instance from TimeMS
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void SetInstanceAnimation(int32 InstanceIndex, int32 AnimationIndex, float TimeMS = 0.f);
+
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void SetInstanceLocation(int32 InstanceIndex, const FVector& Location);
+
+	// Returns the Entity Instances play, or nullptr
+	FSpriterEntity* GetEntity() const;
+
+protected:
+
+	// Advances an Instance's time, looping or holding the last frame like Spriter does
+	void AdvanceInstance(FSpriterCrowdInstance& Instance, float DeltaTime) const;
+
+	// Returns true if the Crowd has to be rebuilt, because it was marked dirty or an Instance reached another Sample or Animation
+	bool NeedsDrawCalls();
+
+	// Samples the Instances that changed and writes their Sprites into the Draw Calls, the others keep theirs
+	void BuildDrawCalls();
+
+	// Writes an Instance's Sprites into the Draw Calls from FirstDrawCall on, and returns how many it wrote
+	int32 BuildInstance(FSpriterCrowdInstance& Instance, const FSpriterBakedAnimation& Baked, int32 SampleIndex, float SampleAlpha, int32 FirstDrawCall);
+
+	// Composes every Bone of a Mainline Key into TimelineTransforms, Parents before their Children whatever order the Refs are listed in
+	void ComposeBones(const FSpriterMainlineKey& MainlineKey, const FSpriterBakedAnimation& Baked, int32 SampleIndex, float SampleAlpha, const FSpriterTransform2D& Root);
+
+	// Returns the Skeleton's Baked Animation, or Bakes it for the Crowd if the Skeleton has none
+	const FSpriterBakedAnimation* GetBakedAnimation(int32 AnimationIndex);
+
+	UPaperSprite* GetSprite(const FSpriterFile& File);
+
+	// Animations Baked by the Crowd itself, indexed like the Entity's Animations
+	TArray<FSpriterBakedAnimation> FallbackBakes;
+
+	// Sprite of every File under the Character Map, indexed by FSpriterFile::TableIndex
+	UPROPERTY(Transient)
+		TArray<UPaperSprite*> ResolvedSprites;
+
+	// Set when ResolvedSprites has to be resolved again
+	bool bSpritesDirty;
+
+	// Change Count of the Character Map when ResolvedSprites was resolved, so changed Entrys are noticed
+	int32 ResolvedChangeCount;
+
+	// Set when the Crowd has to be rebuilt whether or not an Instance reached another Sample
+	bool bInstancesDirty;
+
+	// World Transform of every Timeline of the Instance being built, reused between Instances
+	TArray<FSpriterTransform2D> TimelineTransforms;
+
+	// Whether each Timeline of the Instance being built was composed yet, reused between Instances
+	TArray<bool> ComposedTimelines;
+
+	// Object Refs of the Instance being built in Z Index order, reused between Instances
+	TArray<const FSpriterObjectRef*> DrawOrder;
+};
@@ -0,0 +1,23 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SpriterDataModel.h"
+
+// Spriter's easing Curves, all evaluated in closed form so an eased Key costs about the same as a linear one
+struct SPRITER_API FSpriterCurve
+{
+public:
+
+	// Eases a linear Alpha (0..1) between two Keys with the given Curve and control values
+	static float Ease(ESpriterCurveType CurveType, float C1, float C2, float C3, float C4, float Alpha);
+
+	// Eases the time within a Mainline Key (until the next one, or the end) with its Curve, Timeline Keys are then found and eased at the returned time
+	static float EaseMainlineTime(const FSpriterAnimation& Animation, int32 MainlineKey, float TimeMS);
+
+	// Eases the Alpha of a Timeline Key with its own Curve
+	static float EaseTimelineAlpha(const FSpriterTimelineKey& Key, float Alpha);
+
+	// Solves a Bezier with control points (0,0), (C1,C2), (C3,C4), (1,1) for the Y at X
+	static float SolveBezier(float C1, float C2, float C3, float C4, float X);
+};
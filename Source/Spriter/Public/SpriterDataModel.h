@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "SpriterTransform2D.h"
 #include "SpriterDataModel.generated.h"
 
 // This file contains the definition of various Spriter data types
@@ -39,7 +40,10 @@ enum class ESpriterCurveType : uint8
 	/** Default when not specified */
 	Linear,
 	Quadratic,
-	Cubic
+	Cubic,
+	Quartic,
+	Quintic,
+	Bezier
 };
 
 UENUM()
@@ -132,6 +136,9 @@ struct SPRITER_API  FSpriterFile
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 	ESpriterFileType FileType;
 
+	// Index of this File across every Folder, cached by USpriterImportData::BuildDerivedData so Files can index flat tables
+	int32 TableIndex;
+
 public:
 	FSpriterFile();
 	bool ParseFromJSON(TSharedPtr<FJsonObject> Tree, const FString& NameForErrors, bool bSilent);
@@ -356,9 +363,22 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 	TArray<FSpriterObjectRef> ObjectRefs;
 
+	// Eases the time until the next Mainline Key, Timeline Keys are then interpolated with their own Curves at the eased time
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 	ESpriterCurveType CurveType;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+	float C1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+	float C2;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+	float C3;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+	float C4;
+
 public:
 	FSpriterMainlineKey();
 	bool ParseFromJSON(FSpriterEntity* Owner, FSpriterAnimation* Animation, TSharedPtr<FJsonObject> Tree, const FString& NameForErrors, bool bSilent);
@@ -384,6 +404,12 @@ public:
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 	float C2;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+	float C3;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+	float C4;
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 	int32 Spin;
@@ -419,6 +445,20 @@ struct SPRITER_API  FSpriterFatTimelineKey : public FSpriterTimelineKey
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 	bool bUseDefaultPivot;
 
+	// Derived data, cached by USpriterImportData::BuildDerivedData so the runtime only has to interpolate
+
+	// Position (in Unreal Units), Angle and Scale ready to lerp
+	FSpriterTransform2D Transform;
+
+	// Pivot (in Unreal Units) rotated by this Key's Angle
+	FVector2D RotatedPivot;
+
+	// The File this Key shows, nullptr if it doesnt show one
+	FSpriterFile* File;
+
+	// Offset (in Unreal Units) from the File's default Pivot, which imported Sprites use, to this Key's Pivot
+	FVector2D PivotOffset;
+
 	// Overrides linear!
 public:
 	FSpriterFatTimelineKey();
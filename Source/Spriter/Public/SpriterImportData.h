@@ -3,6 +3,9 @@
 #pragma once
 
 #include "SpriterDataModel.h" //@TODO: For debug only
+#include "SpriterBakedAnimation.h"
+#include "SpriterRootTrack.h"
+#include "SpriterSkeletonBinding.h"
 #include "SpriterImportData.generated.h"
 
 // This is the 'hub' asset that tracks other imported assets for a rigged sprite character exported from Spriter
@@ -18,10 +21,71 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 	float PixelsPerUnrealUnit;
 
+	// Samples per second to Bake every Animation at, 0 only keeps the Keyframes
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter", meta = (ClampMin = "0"))
+	float BakeSampleRate;
+
+	// Bone whose motion every Animation gets a Root Track of, for Skeletons extracting Root Motion. Empty builds no Root Tracks
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+	FString RootBoneName;
+
+	// Samples per second of the Root Tracks
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter", meta = (ClampMin = "1"))
+	float RootTrackSampleRate;
+
 	// Import data for this 
 	UPROPERTY(EditAnywhere, Instanced, Category=ImportSettings)
 	class UAssetImportData* AssetImportData;
 
 	/** Override to ensure we write out the asset import data */
 	virtual void GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const override;
+
+	virtual void Serialize(FArchive& Ar) override;
+
+	virtual void PostLoad() override;
+
+	virtual SIZE_T GetResourceSize(EResourceSizeMode::Type Mode) override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// Caches the Unreal Unit Transform, rotated Pivot and resolved File of every Timeline Key, needs to be called again whenever ImportedData changes
+	void BuildDerivedData();
+
+	FORCEINLINE bool HasDerivedData() const { return bDerivedDataBuilt; }
+
+	// Number of Files across every Folder, the size of a table indexed by FSpriterFile::TableIndex
+	FORCEINLINE int32 GetNumFiles() const { return NumFiles; }
+
+	// Returns the Baked version of an Animation, or nullptr if Animations arent Baked
+	const FSpriterBakedAnimation* GetBakedAnimation(const FSpriterAnimation* Animation) const;
+
+	// Returns the Root Track of an Animation, or nullptr if it doesnt animate the Root Bone
+	const FSpriterRootTrack* GetRootTrack(const FSpriterAnimation* Animation) const;
+
+	// Returns the Binding shared by every Skeleton playing one of this asset's Entitys, or nullptr
+	const FSpriterSkeletonBinding* GetEntityBinding(const FSpriterEntity* Entity) const;
+
+private:
+	// Index of an Animation across every Entity, Entity after Entity, or INDEX_NONE if it isnt one of this asset's
+	int32 GetAnimationIndex(const FSpriterAnimation* Animation) const;
+
+	// Baked Animations of every Entity, Entity after Entity in the same order as their Animations.
+	// Serialized in cooked assets only, Editor assets Bake again on load so they always match the current Bake
+	TArray<FSpriterBakedAnimation> BakedAnimations;
+
+	// Set while BakedAnimations were loaded from a cooked asset and dont need Baking again
+	bool bBakeLoaded;
+
+	// Root Tracks of every Entity, laid out like BakedAnimations
+	TArray<FSpriterRootTrack> RootTracks;
+
+	// Binding of every Entity, in the same order as the Entitys. Rebuilt in place, so Skeletons keep pointing at them
+	TArray<FSpriterSkeletonBinding> EntityBindings;
+
+	// Not serialized, so loaded and duplicated assets always rebuild their derived data
+	bool bDerivedDataBuilt;
+
+	int32 NumFiles;
 };
@@ -0,0 +1,112 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SpriterDataModel.h"
+
+// Remembers the Key under the current time for the Mainline, every Timeline and every Event Line of one Animation.
+// As time advances the Cursors only step forward, seeks, loop wraps and blends fall back to a binary search.
+struct SPRITER_API FSpriterPlaybackCursor
+{
+public:
+
+	// Number of Keys a Cursor may step forward before a binary search is cheaper
+	static const int32 MAX_LINEAR_STEPS = 4;
+
+	// The Animation the Cursors belong to
+	const FSpriterAnimation* Animation;
+
+	int32 MainlineKey;
+
+	// Cursor of each Timeline, indexed like FSpriterAnimation::Timelines
+	TArray<int32> TimelineKeys;
+
+	// Cursor of each Event Line, indexed like FSpriterAnimation::EventLines
+	TArray<int32> EventLineKeys;
+
+	FSpriterPlaybackCursor();
+
+	// Points the Cursors at a new Animation, forgetting all remembered Keys
+	void Reset(const FSpriterAnimation* NewAnimation);
+
+	// Alpha between two Keys of a playing Animation, a Second Key at time 0 means the Animation wraps around to its start
+	static float GetPlayingAlpha(float TimeMS, int32 FirstTimeMS, int32 SecondTimeMS, int32 LengthInMS);
+
+	// Returns the index of the last Key with TimeInMS <= TimeMS (INDEX_NONE if there is none), and moves the Cursor to it
+	template<typename KeyType>
+	static int32 FindKey(const TArray<KeyType>& Keys, float TimeMS, int32& Cursor)
+	{
+		const int32 NumKeys = Keys.Num();
+
+		// Time only moved forward, so step ahead from the remembered Key
+		int32 Index = Cursor;
+		if (Index >= 0 && Index < NumKeys && Keys[Index].TimeInMS <= TimeMS)
+		{
+			for (int32 Step = 0; Step <= MAX_LINEAR_STEPS; ++Step)
+			{
+				if (Index + 1 >= NumKeys || Keys[Index + 1].TimeInMS > TimeMS)
+				{
+					Cursor = Index;
+					return Index;
+				}
+
+				++Index;
+			}
+		}
+
+		// Seek, Loop wrap or Blend, search for the first Key past TimeMS
+		int32 Low = 0;
+		int32 High = NumKeys;
+		while (Low < High)
+		{
+			const int32 Middle = (Low + High) / 2;
+			if (Keys[Middle].TimeInMS <= TimeMS)
+			{
+				Low = Middle + 1;
+			}
+			else
+			{
+				High = Middle;
+			}
+		}
+
+		Cursor = Low - 1;
+		return Cursor;
+	}
+};
+
+// Two Keys to interpolate between and how far between them the current time is
+template<typename KeyType>
+struct TSpriterKeyPair
+{
+public:
+
+	KeyType* First;
+
+	KeyType* Second;
+
+	float Alpha;
+
+	TSpriterKeyPair()
+		: First(nullptr)
+		, Second(nullptr)
+		, Alpha(0.f)
+	{
+	}
+
+	FORCEINLINE void Reset()
+	{
+		First = nullptr;
+		Second = nullptr;
+		Alpha = 0.f;
+	}
+
+	FORCEINLINE bool IsValid() const
+	{
+		return First && Second;
+	}
+};
+
+typedef TSpriterKeyPair<FSpriterMainlineKey> FSpriterMainlineKeyPair;
+typedef TSpriterKeyPair<FSpriterFatTimelineKey> FSpriterTimelineKeyPair;
+typedef TSpriterKeyPair<FSpriterEventLineKey> FSpriterEventLineKeyPair;
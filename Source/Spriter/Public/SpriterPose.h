@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SpriterPlaybackCursor.h"
+#include "SpriterTransform2D.h"
+
+// Sampled state of every Object slot of a Skeleton, one array per channel so a whole Animation is evaluated in a single pass.
+// Slots are laid out like FSpriterSkeletonBinding (Bones, then Sprites, then Boxs, then Points).
+struct SPRITER_API FSpriterPose
+{
+public:
+
+	TArray<float> X;
+
+	TArray<float> Y;
+
+	// Angle (in degrees)
+	TArray<float> Angle;
+
+	TArray<float> ScaleX;
+
+	TArray<float> ScaleY;
+
+	TArray<float> Alpha;
+
+	// Tint of each slot, its Alpha lives in the Alpha channel
+	TArray<FLinearColor> Color;
+
+	// Whether the slot had Keys to sample in the last evaluation
+	TArray<bool> Sampled;
+
+	// Sizes every channel, only reallocates when the Skeleton grows
+	void SetNum(int32 NumSlots);
+
+	void Empty();
+
+	FORCEINLINE int32 Num() const
+	{
+		return Sampled.Num();
+	}
+
+	FORCEINLINE bool IsSampled(int32 Slot) const
+	{
+		return Sampled.IsValidIndex(Slot) && Sampled[Slot];
+	}
+
+	FORCEINLINE FSpriterTransform2D GetTransform(int32 Slot) const
+	{
+		return FSpriterTransform2D(X[Slot], Y[Slot], Angle[Slot], ScaleX[Slot], ScaleY[Slot]);
+	}
+
+	FLinearColor GetColor(int32 Slot) const;
+
+	// Writes a slot that was sampled somewhere else, like from a Baked Animation
+	void SetSlot(int32 Slot, const FSpriterTransform2D& Transform, const FLinearColor& SlotColor);
+};
+
+// The one place Timeline Keys get interpolated, every Object type reads its result from the Pose
+struct SPRITER_API FSpriterPoseEvaluator
+{
+public:
+
+	// Samples every slot's Key Pair into the Pose, slots without a valid Pair are marked as not Sampled
+	static void Evaluate(const TArray<FSpriterTimelineKeyPair>& KeyPairs, FSpriterPose& OutPose);
+
+	// Moves every slot sampled in both Poses towards From by Weight (0 keeps InOutPose, 1 copies From), angles take the shortest way
+	static void Blend(const FSpriterPose& From, float Weight, FSpriterPose& InOutPose);
+};
@@ -0,0 +1,89 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SpriterPose.h"
+
+class USpriterImportData;
+
+// What a cached Pose was evaluated from, the Animation pointer already tells Entities apart
+struct SPRITER_API FSpriterPoseCacheKey
+{
+public:
+
+	const USpriterImportData* ImportData;
+
+	const FSpriterAnimation* Animation;
+
+	// Quantized time (in milliseconds) the Pose was evaluated at
+	float TimeMS;
+
+	// Whether the Pose was sampled from the Baked Animation, which is quantized, or interpolated from the Keys
+	bool bBaked;
+
+	FSpriterPoseCacheKey(const USpriterImportData* InImportData, const FSpriterAnimation* InAnimation, float InTimeMS, bool bInBaked);
+
+	FORCEINLINE bool operator==(const FSpriterPoseCacheKey& Other) const
+	{
+		return ImportData == Other.ImportData && Animation == Other.Animation && TimeMS == Other.TimeMS && bBaked == Other.bBaked;
+	}
+
+	friend FORCEINLINE uint32 GetTypeHash(const FSpriterPoseCacheKey& Key)
+	{
+		return HashCombine(HashCombine(HashCombine(PointerHash(Key.ImportData), PointerHash(Key.Animation)), GetTypeHash(Key.TimeMS)), GetTypeHash(Key.bBaked));
+	}
+};
+
+// Local Poses evaluated this frame, shared by every Skeleton playing the same Animation at the same quantized time.
+// Skeletons that hit copy the Pose and Keys and only compose and render on their own. Entries only live for one frame,
+// so the cache never grows past the number of distinct Animation times on screen and never outlives reimported data.
+class SPRITER_API FSpriterPoseCache
+{
+public:
+
+	static FSpriterPoseCache& Get();
+
+	// Copies a cached Pose (and the Keys it was evaluated from) out, returns false on a miss
+	bool Find(const FSpriterPoseCacheKey& Key, FSpriterPose& OutPose, TArray<FSpriterTimelineKeyPair>& OutKeyPairs, FSpriterMainlineKeyPair& OutMainlineKeyPair);
+
+	// Stores a Pose evaluated after a miss
+	void Add(const FSpriterPoseCacheKey& Key, const FSpriterPose& Pose, const TArray<FSpriterTimelineKeyPair>& KeyPairs, const FSpriterMainlineKeyPair& MainlineKeyPair);
+
+	FORCEINLINE int32 GetNumHits() const { return Hits.GetValue(); }
+
+	FORCEINLINE int32 GetNumMisses() const { return Misses.GetValue(); }
+
+	void ResetStats();
+
+private:
+
+	struct FEntry
+	{
+		FSpriterPose Pose;
+
+		TArray<FSpriterTimelineKeyPair> KeyPairs;
+
+		FSpriterMainlineKeyPair MainlineKeyPair;
+	};
+
+	FSpriterPoseCache();
+
+	// Drops last frame's entries, the caller holds the lock
+	void FlushIfStale();
+
+	FCriticalSection Lock;
+
+	// Frame the entries were evaluated in
+	uint64 Frame;
+
+	TMap<FSpriterPoseCacheKey, int32> EntryIndices;
+
+	// Entries stay allocated between frames, only NumEntries is reset, so their buffers are reused
+	TArray<FEntry> Entries;
+
+	int32 NumEntries;
+
+	FThreadSafeCounter Hits;
+
+	FThreadSafeCounter Misses;
+};
@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "Components/MeshComponent.h"
+#include "SpriteDrawCall.h"
+#include "SpriterDataModel.h"
+#include "SpriterRenderComponent.generated.h"
+
+class FSpriterDrawCallRecycler;
+struct FSpriterDrawCallBuffer;
+
+// Draws every Sprite of a Skeleton from one Primitive, instead of one Paper Sprite Component per Sprite.
+// The Skeleton builds the vertices on the CPU in draw order, Sprites sharing a Texture end up in the same draw call.
+// Every Draw Call carries its own Material, consecutive Draw Calls sharing one are drawn as a single section.
+UCLASS( ClassGroup=(Spriter), meta=(BlueprintSpawnableComponent))
+class SPRITER_API USpriterRenderComponent : public UMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	USpriterRenderComponent();
+
+	// Replaces everything drawn, Draw Calls are given in component space and in draw order, each with the Material at the same index.
+	// The arrays are swapped rather than copied, the caller gets the previous ones back to fill the next time
+	void SetDrawCalls(TArray<FSpriteDrawCallRecord>& NewDrawCalls, TArray<UMaterialInterface*>& NewMaterials);
+
+	// Fills a Draw Call with a Sprite placed by a 2D Transform and pivoted on the Key's Pivot, without touching the shared Sprite asset
+	static void BuildDrawCall(FSpriteDrawCallRecord& OutDrawCall, UPaperSprite* Sprite, const FSpriterFatTimelineKey& Key, const FSpriterTransform2D& Transform, const FLinearColor& Color);
+
+	// UPrimitiveComponent interface
+	virtual FPrimitiveSceneProxy* CreateSceneProxy() override;
+	virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+	virtual void SendRenderDynamicData_Concurrent() override;
+	virtual int32 GetNumMaterials() const override;
+	// End of UPrimitiveComponent interface
+
+protected:
+
+	// Updates the Bounds and sends the Draw Calls to the renderer, after they were changed in place
+	void MarkDrawCallsDirty();
+
+	// Copies the Draw Calls into a recycled Buffer the Scene Proxy takes them from
+	FSpriterDrawCallBuffer* FillDrawCallBuffer();
+
+	// Draw Calls last set, sent to the Scene Proxy when the render dynamic data is
+	TArray<FSpriteDrawCallRecord> DrawCalls;
+
+	// Material of every Draw Call, indexed like DrawCalls. Material slot 0 overrides them all when set
+	TArray<UMaterialInterface*> DrawCallMaterials;
+
+	// Every Material a Draw Call used so far, the Scene Proxy's relevance is built from them
+	UPROPERTY(Transient)
+		TArray<UMaterialInterface*> UsedMaterials;
+
+	// Bounds of every Draw Call, in component space
+	FBox LocalBounds;
+
+	// Buffers the Draw Calls are sent to the Scene Proxy in, shared with the Proxy so it can hand them back once drawn
+	TSharedPtr<FSpriterDrawCallRecycler, ESPMode::ThreadSafe> DrawCallRecycler;
+};
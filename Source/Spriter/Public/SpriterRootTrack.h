@@ -0,0 +1,43 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SpriterDataModel.h"
+
+// The motion of one Bone through an Animation, sampled at a fixed rate so extracting Root Motion is two lookups and a lerp.
+// Values are the Bone's own Timeline values, so the Bone should be attached to the Skeleton root.
+struct SPRITER_API FSpriterRootTrack
+{
+public:
+
+	// Samples per second
+	float SampleRate;
+
+	int32 NumSamples;
+
+	int32 LengthInMS;
+
+	// Position (X, Y) and Angle (Z, unwound so it never jumps by a full turn) of the Bone at each Sample
+	TArray<FVector> Samples;
+
+	FSpriterRootTrack();
+
+	// Samples the Bone's Timeline with the Keyframe evaluator, leaves the Track invalid if the Animation doesnt animate the Bone
+	void Build(FSpriterAnimation& Animation, const FString& BoneName, float InSampleRate);
+
+	// Position and Angle of the Bone at TimeMS
+	FVector Evaluate(float TimeMS) const;
+
+	// Translation and Rotation (in degrees) of the Bone from StartMS to EndMS
+	void GetDelta(float StartMS, float EndMS, FVector2D& OutTranslation, float& OutRotation) const;
+
+	FORCEINLINE bool IsValid() const
+	{
+		return NumSamples > 1;
+	}
+
+	FORCEINLINE float GetSampleTimeMS(int32 SampleIndex) const
+	{
+		return FMath::Min<float>(LengthInMS, (SampleIndex * 1000.f) / SampleRate);
+	}
+};
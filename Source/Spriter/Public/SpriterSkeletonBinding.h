@@ -0,0 +1,106 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "SpriterDataModel.h"
+
+// Index based Binding of a Skeleton's Objects to the Timelines and Mainline Refs of a single Animation
+struct SPRITER_API FSpriterAnimationBinding
+{
+public:
+
+	// Timeline index of each Object slot, INDEX_NONE when the Object has no Timeline in this Animation
+	TArray<int32> ObjectTimelines;
+
+	// Event Line index of each Event, INDEX_NONE when the Event has no Event Line in this Animation
+	TArray<int32> EventLines;
+
+	// Object slot of each Timeline, INDEX_NONE when no Object was created for the Timeline
+	TArray<int32> TimelineObjects;
+
+	// Ref index of each Object slot in each Mainline Key, stored as [KeyIndex * NumObjects + Slot]. Bones index into BoneRefs, all other Objects into ObjectRefs
+	TArray<int32> MainlineRefs;
+
+	int32 NumObjects;
+
+	FSpriterAnimationBinding();
+
+	// Returns the Ref index of the Object slot in the Mainline Key, or INDEX_NONE if the Key doesnt reference it
+	int32 GetRefIndex(int32 KeyIndex, int32 Slot) const;
+
+	// Returns the Object slot animated by the Timeline, or INDEX_NONE
+	int32 GetTimelineObject(int32 TimelineIndex) const;
+};
+
+// Lookup tables built once per Entity with the Skeleton's derived data and shared by every Skeleton Component playing it,
+// so updating never has to search for anything by Name. Object slots are laid out as Bones, then Sprites, then Boxs, then Points
+struct SPRITER_API FSpriterSkeletonBinding
+{
+public:
+
+	int32 NumBones;
+
+	int32 NumSprites;
+
+	int32 NumBoxs;
+
+	int32 NumPoints;
+
+	int32 NumEvents;
+
+	// Name of each Object, in slot order within its kind
+	TArray<FString> BoneNames;
+
+	TArray<FString> SpriteNames;
+
+	TArray<FString> BoxNames;
+
+	TArray<FString> PointNames;
+
+	TArray<FString> EventNames;
+
+	// Parent Bone index of each Bone, INDEX_NONE for Bones attached to the Skeleton root
+	TArray<int32> BoneParents;
+
+	// One Binding per Animation, in the same order as the Entity's Animations
+	TArray<FSpriterAnimationBinding> Animations;
+
+	FSpriterSkeletonBinding();
+
+	// Builds all tables for the Entity, finding its Objects the way a Skeleton creates them, with Bones sorted Parent before Child
+	void Build(const FSpriterEntity& Entity);
+
+	// Builds all tables for the Entity, the Name arrays must be in the same order as the Skeleton's instance arrays
+	void Build(const FSpriterEntity& Entity, const TArray<FString>& InBoneNames, const TArray<FString>& InSpriteNames, const TArray<FString>& InBoxNames, const TArray<FString>& InPointNames, const TArray<FString>& InEventNames);
+
+	void Reset();
+
+	bool IsBound() const;
+
+	// True when every Bone's Parent comes before it, so World Transforms can be composed in one pass
+	bool AreBonesSorted() const;
+
+	// Fills OutOrder with the Bone indices sorted Parent before Child, keeping the original order among siblings
+	void GetSortedBoneOrder(TArray<int32>& OutOrder) const;
+
+	// Returns the Binding of an Animation that belongs to the Entity the tables were built for
+	const FSpriterAnimationBinding* GetAnimationBinding(const FSpriterEntity& Entity, const FSpriterAnimation* Animation) const;
+
+	SIZE_T GetAllocatedSize() const;
+
+	// Binding of no Entity, for Skeletons that arent Initialized
+	static const FSpriterSkeletonBinding& GetEmpty();
+
+	FORCEINLINE int32 GetNumObjects() const { return NumBones + NumSprites + NumBoxs + NumPoints; }
+
+	FORCEINLINE int32 GetBoneSlot(int32 BoneIndex) const { return BoneIndex; }
+
+	FORCEINLINE int32 GetSpriteSlot(int32 SpriteIndex) const { return NumBones + SpriteIndex; }
+
+	FORCEINLINE int32 GetBoxSlot(int32 BoxIndex) const { return NumBones + NumSprites + BoxIndex; }
+
+	FORCEINLINE int32 GetPointSlot(int32 PointIndex) const { return NumBones + NumSprites + NumBoxs + PointIndex; }
+
+	// Returns the Bone index of an Object slot, or INDEX_NONE if the slot isnt a Bone
+	FORCEINLINE int32 SlotToBone(int32 Slot) const { return (Slot >= 0 && Slot < NumBones) ? Slot : INDEX_NONE; }
+};
@@ -5,7 +5,13 @@
 #include "Components/SceneComponent.h"
 #include "SpriterImportData.h"
 #include "SpriterCharacterMap.h"
+#include "SpriterSkeletonBinding.h"
+#include "SpriterPlaybackCursor.h"
+#include "SpriterPose.h"
+#include "SpriterPoseCache.h"
 #include "PaperSpriteComponent.h"
+#include "SpriterRenderComponent.h"
+#include "SpriterBlendSpace.h"
 #include "SpriterSkeletonComponent.generated.h"
 
 class USpriterSkeletonComponent;
@@ -18,6 +24,17 @@ enum class ESpriterAnimationState : uint8
 	BLENDING
 };
 
+UENUM(BlueprintType)
+enum class ESpriterUpdateLOD : uint8
+{
+	// Everything is evaluated and pushed every frame
+	FULL,
+	// Evaluated at ReducedUpdateRate, for Skeletons far from every player
+	REDUCED,
+	// Sprites arent evaluated or pushed, only Bones, Boxs and Points (or nothing) are, for Skeletons that werent rendered lately
+	HIDDEN
+};
+
 USTRUCT(BlueprintType)
 struct SPRITER_API FSpriterBoneInstance
 {
@@ -33,12 +50,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		FString ParentBoneName;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		int32 ParentBoneIndex;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		FTransform RelativeTransform;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		FTransform WorldTransform;
 
+	// World Transform in Spriter's 2D space, WorldTransform is converted from it once per Update
+	FSpriterTransform2D WorldTransform2D;
+
 	FSpriterBoneInstance();
 };
 
@@ -58,18 +81,50 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		FString ParentBoneName;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		int32 ParentBoneIndex;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		int32 ZIndex;
 
+	// Only converted from RelativeTransform2D when read through GetSprite or GetSpriteByName
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		FTransform RelativeTransform;
 
+	// Only converted from WorldTransform2D when read through GetSprite or GetSpriteByName
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		FTransform WorldTransform;
 
+	// Relative and World Transforms in Spriter's 2D space, Sprites stay in 2D until they are pushed
+	FSpriterTransform2D RelativeTransform2D;
+
+	FSpriterTransform2D WorldTransform2D;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		UPaperSpriteComponent* SpriteComponent;
 
+	// Results of the last evaluation, applied to the Sprite Component on the game thread
+	FSpriterTransform2D PivotedTransform2D;
+
+	FLinearColor EvaluatedColor;
+
+	FSpriterFatTimelineKey* EvaluatedKey;
+
+	// Values last pushed to the Sprite Component (or the batch), so unchanged values arent pushed again
+	bool bPushed;
+
+	bool bPushedActive;
+
+	int32 PushedZIndex;
+
+	FSpriterTransform2D PushedTransform2D;
+
+	FLinearColor PushedColor;
+
+	UPaperSprite* PushedSprite;
+
+	FSpriterFatTimelineKey* PushedKey;
+
 	FSpriterSpriteInstance();
 };
 
@@ -89,6 +144,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		FString ParentBoneName;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		int32 ParentBoneIndex;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		int32 ZIndex;
 
@@ -98,6 +156,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		FTransform WorldTransform;
 
+	// World Transform in Spriter's 2D space, WorldTransform is converted from it once per Update
+	FSpriterTransform2D WorldTransform2D;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		FVector Pivot;
 
@@ -123,6 +184,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		FString ParentBoneName;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		int32 ParentBoneIndex;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		int32 ZIndex;
 
@@ -132,6 +196,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		FTransform WorldTransform;
 
+	// World Transform in Spriter's 2D space, WorldTransform is converted from it once per Update
+	FSpriterTransform2D WorldTransform2D;
+
 	FSpriterPointInstance();
 };
 
@@ -151,6 +218,71 @@ public:
 	FSpriterEventInstance();
 };
 
+UENUM(BlueprintType)
+enum class ESpriterLayerBlendMode : uint8
+{
+	// Blends from the Pose below towards the Layer's Pose by Weight
+	OVERRIDE,
+	// Adds the Layer's change from its Animation's first frame on top of the Pose below, scaled by Weight
+	ADDITIVE
+};
+
+// An Animation played on top of the Skeleton's Active Animation, on the Objects its Mask selects
+USTRUCT(BlueprintType)
+struct SPRITER_API FSpriterAnimationLayer
+{
+	GENERATED_USTRUCT_BODY()
+
+public:
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		FString AnimationName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		float TimeMS;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		float PlayRate;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		float Weight;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		ESpriterLayerBlendMode BlendMode;
+
+	// Names of the Objects the Layer affects, a Bone brings its child Bones along, empty affects everything
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		TArray<FString> Mask;
+
+	// Resolved from AnimationName when the Layer is added or the Skeleton initialized
+	FSpriterAnimation* Animation;
+
+	// 1 for every Object slot the Mask selects, 0 for the others
+	TArray<float> SlotWeights;
+
+	// The Layer's own evaluation buffers, preallocated like the Skeleton's
+	FSpriterPlaybackCursor Cursor;
+
+	TArray<FSpriterTimelineKeyPair> KeyPairs;
+
+	FSpriterPose Pose;
+
+	// The Animation's first frame, what ADDITIVE Layers are measured against
+	FSpriterPose ReferencePose;
+
+	bool bReferencePoseValid;
+
+	FSpriterAnimationLayer();
+};
+
+// An Event Key reached this frame, queued so every Event of a frame is broadcast together and in time order
+struct FSpriterPendingEvent
+{
+	int32 TimeMS;
+
+	int32 EventIndex;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FAnimationEnded, USpriterSkeletonComponent*, Skeleton, const FSpriterAnimation&, EndedAnimation, const bool, WasForced);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FAnimationStarted, USpriterSkeletonComponent*, Skeleton, const FSpriterAnimation&, StartedAnimation, const bool, FirstTime);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FAnimationEvent, USpriterSkeletonComponent*, Skeleton, const FString&, EventName);
@@ -204,6 +336,115 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
 		float BlendDurationMS;
 
+	// Blends start from a snapshot of the last evaluated Pose and the new Animation plays right away, so interrupting a Blend never pops.
+	// Otherwise Blends go from the Key under the current time to the first Key of the next Animation.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		bool bBlendFromSnapshot;
+
+	// Plays Baked Animations when the Skeleton has them, otherwise (and while Blending) Keyframes are evaluated
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		bool bUseBakedAnimations;
+
+	// Samples and composes the Skeleton on a worker thread, only applying the results and firing delegates happens on the game thread
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		bool bParallelEvaluation;
+
+	// Draws all Sprites through one Render Component instead of one Sprite Component each, takes effect the next time the Skeleton is initialized
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		bool bBatchSprites;
+
+	// How much a Sprite's Transform or Color may change before it is pushed to its Sprite Component again
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter", meta = (ClampMin = "0"))
+		float PushTolerance;
+
+	// Sprite Component updates made by the last Update
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Spriter")
+		int32 NumPushedUpdates;
+
+	// Sprite Component updates skipped by the last Update, because nothing changed
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Spriter")
+		int32 NumSkippedUpdates;
+
+	// Most Sprite Components Cleanup keeps hidden for the next Init to reuse, any more are destroyed
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter", meta = (ClampMin = "0"))
+		int32 MaxPooledSpriteComponents;
+
+	// Layers blended over the Active Animation, in order
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spriter")
+		TArray<FSpriterAnimationLayer> Layers;
+
+	// Takes the Root Bone's motion (see USpriterImportData::RootBoneName) out of the Pose and hands it out in RootMotionTranslation and RootMotionRotation instead
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter|RootMotion")
+		bool bExtractRootMotion;
+
+	// Root Bone translation of the last Update, in the Skeleton's 2D space (Unreal Units)
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Spriter|RootMotion")
+		FVector2D RootMotionTranslation;
+
+	// Root Bone rotation (in degrees) of the last Update
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Spriter|RootMotion")
+		float RootMotionRotation;
+
+	// The Blend Space being played, its heaviest Sample is the Active Animation
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Spriter")
+		USpriterBlendSpace* ActiveBlendSpace;
+
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Spriter")
+		FVector2D BlendSpaceInput;
+
+	// Weights of the Samples blended this frame, heaviest first
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Spriter")
+		TArray<FSpriterBlendSampleWeight> BlendSpaceWeights;
+
+	// Shares evaluated Poses with every other Skeleton playing the same Animation at the same quantized time
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter")
+		bool bUsePoseCache;
+
+	// Time step (in milliseconds) Playing time is snapped to while using the Pose Cache, larger steps hit more often
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter", meta = (ClampMin = "1"))
+		float PoseCacheQuantumMS;
+
+	// Picks an Update LOD every frame from the thresholds below, otherwise the Skeleton always updates at FULL
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter|LOD")
+		bool bEnableUpdateLOD;
+
+	// Seconds without any Sprite being rendered before the Skeleton drops to HIDDEN
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter|LOD", meta = (ClampMin = "0"))
+		float HiddenTimeout;
+
+	// Keeps Bones, Boxs and Points updating while HIDDEN, for gameplay that reads them
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter|LOD")
+		bool bUpdateGameplayWhenHidden;
+
+	// Distance to the closest player camera beyond which the Skeleton drops to REDUCED, 0 disables it
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter|LOD", meta = (ClampMin = "0"))
+		float ReducedDistance;
+
+	// Evaluations per second while REDUCED, time and Events still advance every frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spriter|LOD", meta = (ClampMin = "1"))
+		float ReducedUpdateRate;
+
+	// The Update LOD picked this frame
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Spriter|LOD")
+		ESpriterUpdateLOD CurrentUpdateLOD;
+
+	// The Render Component drawing the Sprites when they're Batched
+	UPROPERTY(BlueprintReadOnly, Category = "Spriter")
+		USpriterRenderComponent* RenderComponent;
+
+	// Lets the World's Animation Manager update this Skeleton together with all others, instead of ticking on its own.
+	// The Manager only reads these when the Skeleton registers, change them through SetAnimationManager while playing
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spriter")
+		bool bUseAnimationManager;
+
+	// The Tick Group the Animation Manager updates this Skeleton in
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spriter")
+		TEnumAsByte<ETickingGroup> AnimationTickGroup;
+
+	// Skeletons with a higher Priority are updated first within their Tick Group
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spriter")
+		int32 AnimationPriority;
+
 	// The Active Entity
 	FSpriterEntity* ActiveEntity;
 
@@ -218,13 +459,37 @@ public:
 
 	// Checks to see if we need to be Initialized
 	virtual void BeginPlay() override;
+
+	// Leaves the Animation Manager
+	virtual void OnUnregister() override;
+
+#if WITH_EDITOR
+	// Moves a playing Skeleton to the Animation Manager settings edited on it
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 	
 	// Update the Animation based on the State
 	virtual void TickComponent( float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction ) override;
 
+	// Picks this frame's Update LOD and whether the Skeleton evaluates at all, game thread only
+	void UpdateLOD(float DeltaTime);
+
+	// Samples the Pose and composes every Object's Transform, touches nothing but this Component's own data so it can run on any thread
+	void EvaluateSkeleton();
+
+	// Pushes the evaluated Skeleton to the Sprite Components and fires Events, game thread only
+	void ApplySkeleton();
+
+	// Advances time and blends, firing the Animation delegates, game thread only
+	void AdvanceAnimation(float DeltaTime);
+
 
 	//Gameplay Functions
 
+	// Moves this Skeleton between its own Tick and the Animation Manager, or to another Tick Group and Priority
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void SetAnimationManager(bool bUseManager, ETickingGroup TickGroup, int32 Priority);
+
 	// Sets Skeleton if not the same, and populates Bone's and Sprite's arrays
 	UFUNCTION(BlueprintCallable, Category = "Spriter")
 		void SetSkeleton(USpriterImportData* NewSkeleton);
@@ -245,6 +510,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Spriter")
 		void ApplyCharacterMap(USpriterCharacterMap* Map, bool bCreateNewEntrys);
 
+	// Resolves the Character Map into the Sprite table, only needed after editing the Character Map's Entrys directly
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void ResolveCharacterMap();
+
 	// Play the animation that Animation Name references, with an optional Blend Duration
 	UFUNCTION(BlueprintCallable, Category = "Spriter")
 		void PlayAnimation(const FString& AnimationName, float BlendLengthMS);
@@ -265,6 +534,46 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Spriter")
 		void SetToSetupPose();
 
+	// Samples every Timeline of the current Animation into the Pose, the other Updates read from it
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void UpdatePose();
+
+	// Adds a Layer playing an Animation on the Objects in Mask (and their child Bones), returns its index
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		int32 AddLayer(const FString& AnimationName, float Weight, ESpriterLayerBlendMode BlendMode, const TArray<FString>& Mask);
+
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void SetLayerWeight(int32 LayerIndex, float Weight);
+
+	// Plays another Animation on a Layer from TimeMS
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void SetLayerAnimation(int32 LayerIndex, const FString& AnimationName, float TimeMS);
+
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void RemoveLayer(int32 LayerIndex);
+
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void ClearLayers();
+
+	// Plays a Blend Space of the Active Entity's Animations at Input, blending in from the current Pose like PlayAnimation
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void PlayBlendSpace(USpriterBlendSpace* BlendSpace, FVector2D Input, float BlendLengthMS);
+
+	// Moves the Blend Space's Input, every Sample keeps the same normalized time
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void SetBlendSpaceInput(FVector2D Input);
+
+	// RootMotionTranslation in World space, ready for character movement
+	UFUNCTION(BlueprintPure, Category = "Spriter|RootMotion")
+		FVector GetRootMotionWorldTranslation() const;
+
+	// Pose Cache hits and misses of every Skeleton since the stats were last reset
+	UFUNCTION(BlueprintPure, Category = "Spriter")
+		static void GetPoseCacheStats(int32& Hits, int32& Misses);
+
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		static void ResetPoseCacheStats();
+
 	// Update the Bones
 	UFUNCTION(BlueprintCallable, Category = "Spriter")
 		void UpdateBones();
@@ -281,14 +590,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Spriter")
 		void UpdatePoints();
 
-	// Update the Events
+	// Fires every Event Key between the last Update and now, so none are skipped by long frames or Loops
 	UFUNCTION(BlueprintCallable, Category = "Spriter")
 		void UpdateEvents();
 
-	// Clear all Object arrays and destroy all Sprite Components
+	// Clear all Object arrays and return all Sprite Components to the Pool
 	UFUNCTION(BlueprintCallable, Category = "Spriter")
 		void CleanupObjects();
 
+	// Creates Sprite Components ahead of time until the Pool holds Count, or (with a Count of 0) as many as the largest Entity of the Skeleton needs
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void PrewarmSpriteComponents(int32 Count = 0);
+
+	// Destroys every Sprite Component in the Pool
+	UFUNCTION(BlueprintCallable, Category = "Spriter")
+		void EmptySpriteComponentPool();
+
 	// Clear all Object Meta Data
 	UFUNCTION(BlueprintCallable, Category = "Spriter")
 		void CleanupObjectData();
@@ -410,6 +727,10 @@ public:
 
 	FSpriterObjectRef* GetObjectRef(FSpriterAnimation& Animation, FSpriterMainlineKey& Key, const FString& ObjectName);
 
+	FSpriterRef* GetBoneRef(FSpriterAnimation& Animation, FSpriterMainlineKey& Key, int32 BoneIndex);
+
+	FSpriterObjectRef* GetObjectRef(FSpriterAnimation& Animation, FSpriterMainlineKey& Key, int32 ObjectSlot);
+
 	FSpriterObjectInfo* GetObjectInfo(int32 ObjectIndex);
 
 	FSpriterObjectInfo* GetObjectInfo(const FString& ObjectName);
@@ -447,12 +768,160 @@ protected:
 	AActor* Owner;
 
 
+	// Index Lookups for the Active Entity, shared with every Skeleton playing it. Never null, an empty Binding until InitSkeleton
+	const FSpriterSkeletonBinding* Binding;
+
+
 	// Animation Dependant
 	bool bFirstTime;
 
-	TArray<FSpriterMainlineKey*> GetMainlineKeys();
+	// Remembers the current Keys of the Active Animation between Updates
+	FSpriterPlaybackCursor PlaybackCursor;
+
+	// Returns the Playback Cursor, reset first if the Active Animation changed
+	FSpriterPlaybackCursor& GetPlaybackCursor();
+
+	// Mainline Key Pair found by the last UpdatePose
+	FSpriterMainlineKeyPair MainlineKeyPair;
+
+	// CurrentTimeMS eased by the Mainline Key's Curve, the time Timeline Keys are found at while PLAYING
+	float EasedTimeMS;
+
+	// Current Key Pair of every Object slot, preallocated by InitSkeleton
+	TArray<FSpriterTimelineKeyPair> TimelineKeyPairs;
+
+	// Sampled values of every Object slot, preallocated by InitSkeleton
+	FSpriterPose Pose;
+
+	// The Pose a Snapshot Blend fades out from, and whether one is running
+	FSpriterPose BlendSnapshot;
+
+	bool bBlendingFromSnapshot;
+
+	// Fades the Snapshot out over the new Animation's Pose
+	void BlendFromSnapshot();
+
+	// Key Getters write into caller owned storage and return false if no Keys were found, so Updating never allocates
+	bool GetMainlineKeys(FSpriterMainlineKeyPair& OutKeys);
+
+	bool GetTimelineKeys(int32 ObjectSlot, FSpriterTimelineKeyPair& OutKeys);
+
+	// Interpolation Alpha between two Keys for the current Animation State
+	float GetKeyAlpha(int32 FirstTimeMS, int32 SecondTimeMS) const;
+
+	// Returns the Mainline Key (and the Animation it belongs to) whose Refs are currently in effect
+	FSpriterMainlineKey* GetRefKey(const FSpriterMainlineKeyPair& MainKeys, FSpriterAnimation*& OutAnimation);
+
+	const FSpriterAnimationBinding* GetAnimationBinding(const FSpriterAnimation* Animation) const;
+
+	// Composes the Sprites from the Pose, thread safe half of UpdateSprites
+	void EvaluateSprites();
+
+	// Pushes the evaluated Sprites to their Sprite Components, game thread half of UpdateSprites
+	void ApplySprites();
+
+	// Builds every active Sprite's vertices into one batch for the Render Component, in Z Index order
+	void ApplySpritesBatched();
+
+	// Sprite of every File under the Character Map, indexed by FSpriterFile::TableIndex
+	UPROPERTY(Transient)
+		TArray<UPaperSprite*> ResolvedSprites;
+
+	// What the Sprite table was resolved from, so swapping either out directly is noticed
+	UPROPERTY(Transient)
+		USpriterCharacterMap* ResolvedCharacterMap;
+
+	UPROPERTY(Transient)
+		USpriterImportData* ResolvedSkeleton;
+
+	// Change Count of the Character Map when the Sprite table was resolved, so changed Entrys are noticed
+	int32 ResolvedChangeCount;
+
+	// Hidden Sprite Components waiting to be reused
+	UPROPERTY(Transient)
+		TArray<UPaperSpriteComponent*> SpriteComponentPool;
+
+	// Takes a Sprite Component from the Pool, or creates one if the Pool is empty
+	UPaperSpriteComponent* AcquireSpriteComponent(const FString& SpriteName);
+
+	// Hides a Sprite Component and returns it to the Pool, or destroys it if the Pool is full
+	void ReleaseSpriteComponent(UPaperSpriteComponent* SpriteComponent);
+
+	// Creates a hidden Sprite Component, attached and registered
+	UPaperSpriteComponent* CreateSpriteComponent(const FString& SpriteName);
+
+	// Time (in milliseconds) Events have been fired up to, and the Animation it belongs to
+	float EventTimeMS;
+
+	const FSpriterAnimation* EventAnimation;
+
+	// Events reached but not broadcast yet, reused between frames
+	TArray<FSpriterPendingEvent> PendingEvents;
+
+	// Queues every Event Key with a time in (StartMS, EndMS]
+	void QueueEvents(float StartMS, float EndMS);
+
+	// Broadcasts the queued Events in time order
+	void BroadcastPendingEvents();
+
+	// Set by UpdateLOD, false on frames a REDUCED or HIDDEN Skeleton skips
+	bool bEvaluateThisFrame;
+
+	// Seconds since the last evaluation while REDUCED
+	float TimeSinceEvaluation;
+
+	// Returns true if any of the Sprites was rendered within Timeout seconds, or hasnt been pushed to be rendered yet
+	bool WasRecentlyRendered(float Timeout) const;
+
+	// Distance to the closest player camera, or MAX_FLT without one
+	float GetDistanceToClosestCamera() const;
+
+	// Batch storage reused between frames, so Batching doesnt reallocate. It's swapped with the Render Component's every time the batch is set
+	TArray<FSpriteDrawCallRecord> DrawCalls;
+
+	TArray<UMaterialInterface*> DrawCallMaterials;
+
+	TArray<int32> DrawOrder;
+
+	// Evaluates the Pose and Key Pairs at CurrentTimeMS, from the Baked Animation or the Keys
+	void EvaluateLocalPose();
+
+	// Resolves a Layer's Animation and Mask and sizes its buffers for the current Skeleton
+	void PrepareLayer(FSpriterAnimationLayer& Layer);
+
+	// Evaluates a Layer's Animation at TimeMS into OutPose and the Layer's Key Pairs
+	void EvaluateLayerPose(FSpriterAnimationLayer& Layer, float TimeMS, FSpriterPose& OutPose);
+
+	// Evaluates every Layer and blends it into the Pose, in one pass over the slots per Layer
+	void BlendLayers();
+
+	// Advances every Layer's time, looping or holding its last frame
+	void AdvanceLayers(float DeltaTime);
+
+	// Slot of the Skeleton asset's Root Bone in the Active Entity, INDEX_NONE if it has none
+	int32 RootBoneSlot;
+
+	// Locks the Root Bone to where the Active Animation starts, its motion is extracted by AdvanceAnimation instead
+	void RemoveRootMotion();
+
+	// Players of the Active Blend Space's Samples, indexed like its Samples, only Animation and the buffers are used
+	TArray<FSpriterAnimationLayer> BlendSpacePlayers;
+
+	// Recomputes the Sample Weights at BlendSpaceInput, leaving out Samples the Active Entity doesnt have
+	void UpdateBlendSpaceWeights();
+
+	// How much faster than its own length the Active Animation plays, so every Sample finishes a cycle together
+	float GetBlendSpaceTimeScale() const;
+
+	// Evaluates the Active Animation, then blends the other Samples in at the same normalized time
+	void EvaluateBlendSpacePose();
+
+	// Fills the Pose and Key Pairs from a Baked Animation instead of searching Keys
+	void SampleBakedPose(const FSpriterBakedAnimation& Baked);
 
-	TArray<FSpriterFatTimelineKey*> GetTimelineKeys(const FString& ObjectName);
+	// Composes a Relative Transform onto its Parent Bone's World Transform, or returns it as is for the Skeleton root
+	FSpriterTransform2D GetWorldTransform2D(int32 ParentBoneIndex, const FSpriterTransform2D& RelativeTransform) const;
 
-	TArray<FSpriterEventLineKey*> GetEventLineKeys(const FString& EventName);
+	// Returns the Bone index of the Ref's Parent, or INDEX_NONE if the Ref is attached to the Skeleton root
+	int32 GetRefParentBone(const FSpriterAnimation& Animation, const FSpriterRefCommon& Ref) const;
 };
\ No newline at end of file
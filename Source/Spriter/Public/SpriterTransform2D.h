@@ -0,0 +1,41 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+// Position, Angle (in degrees) and Scale of an Object in Spriter's 2D space.
+// Skeletons are composed with these and only converted to an FTransform when the result is pushed to a Scene Component.
+struct SPRITER_API FSpriterTransform2D
+{
+public:
+
+	float X;
+
+	float Y;
+
+	// Angle (in degrees), counter clockwise
+	float Angle;
+
+	float ScaleX;
+
+	float ScaleY;
+
+	FSpriterTransform2D();
+
+	FSpriterTransform2D(float InX, float InY, float InAngle, float InScaleX, float InScaleY);
+
+	// Returns Child (given relative to this Transform) in this Transform's parent space.
+	// Positions go through this Transform's 2x3 affine matrix, Angles are mirrored when this Transform is flipped, like Spriter does.
+	FSpriterTransform2D Compose(const FSpriterTransform2D& Child) const;
+
+	// Returns the Rotated and Scaled unit Axes, a Position P relative to this Transform lands on (X, Y) + AxisX * P.X + AxisY * P.Y
+	void GetAxes(FVector2D& OutAxisX, FVector2D& OutAxisY) const;
+
+	// Converts to the 3D Transform Paper2D expects, matches FSpriterSpatialInfo::ConvertToTransform
+	FTransform ToTransform() const;
+
+	// Returns true if every component is within Tolerance of Other's, Angles compare the shortest way around
+	bool Equals(const FSpriterTransform2D& Other, float Tolerance) const;
+
+	// Interpolates an Angle (in degrees) the way Spriter does, Spin picks the direction of rotation (0 means no rotation)
+	static float LerpAngle(float FirstAngle, float SecondAngle, int32 Spin, float Alpha);
+};
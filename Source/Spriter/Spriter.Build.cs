@@ -12,7 +12,8 @@ public Spriter(TargetInfo Target)
 				"CoreUObject",
                 "Json",
                 "Engine",
-				"Paper2D"
+				"Paper2D",
+				"RenderCore"
 			}
 			);
 
@@ -152,6 +152,7 @@ UObject* USpriterImportFactory::FactoryCreateText(UClass* InClass, UObject* InPa
 		Result = NewObject<USpriterImportData>(InParent, InName, Flags);
 		Result->ImportedData = DataModel;
 		Result->PixelsPerUnrealUnit = GetDefault<UPaperImporterSettings>()->GetDefaultPixelsPerUnrealUnit();
+		Result->BuildDerivedData();
 		Result->Modify();
 
 		// Create Default Character Map